@@ -0,0 +1,272 @@
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+#include "stable_vector.hpp"
+
+namespace
+{
+	struct block64
+	{
+		std::uint64_t values[8];
+	};
+
+	struct block128
+	{
+		std::uint64_t values[16];
+	};
+
+	constexpr std::size_t element_count = 1 << 22;
+	constexpr int repetitions = 20;
+
+	template <typename T, typename Container>
+	void fill(Container& container)
+	{
+		for (std::size_t i = 0; i < element_count; i++)
+		{
+			if constexpr (std::is_same_v<T, block64>)
+			{
+				container.push_back(block64{{i, i, i, i, i, i, i, i}});
+			}
+			else if constexpr (std::is_same_v<T, block128>)
+			{
+				container.push_back(block128{{i, i, i, i, i, i, i, i, i, i, i, i, i, i, i, i}});
+			}
+			else
+			{
+				container.push_back(static_cast<T>(i));
+			}
+		}
+	}
+
+	template <typename T, typename Container>
+	double range_for_ns_per_element(Container& container, std::uint64_t& checksum)
+	{
+		auto start = std::chrono::steady_clock::now();
+		for (int rep = 0; rep < repetitions; rep++)
+		{
+			for (const auto& elem : container)
+			{
+				if constexpr (std::is_same_v<T, block64>)
+				{
+					checksum += elem.values[rep % 8];
+				}
+				else
+				{
+					checksum += elem;
+				}
+			}
+		}
+		auto stop = std::chrono::steady_clock::now();
+		return std::chrono::duration<double, std::nano>(stop - start).count() / (double(element_count) * repetitions);
+	}
+
+	template <typename T, typename Container>
+	double fill_ns_per_element(Container& container)
+	{
+		auto start = std::chrono::steady_clock::now();
+		fill<T>(container);
+		auto stop = std::chrono::steady_clock::now();
+		return std::chrono::duration<double, std::nano>(stop - start).count() / double(element_count);
+	}
+
+	template <typename T, typename Container>
+	double indexed_ns_per_element(Container& container, std::uint64_t& checksum)
+	{
+		auto start = std::chrono::steady_clock::now();
+		for (int rep = 0; rep < repetitions; rep++)
+		{
+			// a stride coprime with the element count visits every index in a cache-unfriendly order
+			for (std::size_t i = 0, index = 0; i < element_count; i++, index = (index + 4099) % element_count)
+			{
+				if constexpr (std::is_same_v<T, block64>)
+				{
+					checksum += container[index].values[rep % 8];
+				}
+				else
+				{
+					checksum += container[index];
+				}
+			}
+		}
+		auto stop = std::chrono::steady_clock::now();
+		return std::chrono::duration<double, std::nano>(stop - start).count() / (double(element_count) * repetitions);
+	}
+
+	template <typename T>
+	void compare_range_for(const char* name)
+	{
+		std::vector<T> vec;
+		my_adt::stable_vector<T> stable_vec;
+		fill<T>(vec);
+		fill<T>(stable_vec);
+
+		std::uint64_t checksum = 0;
+		double vec_ns = range_for_ns_per_element<T>(vec, checksum);
+		double stable_vec_ns = range_for_ns_per_element<T>(stable_vec, checksum);
+		std::printf("range-for %-8s  std::vector %6.3f ns/elem  stable_vector %6.3f ns/elem  ratio %5.2f  (checksum %llu)\n",
+			name, vec_ns, stable_vec_ns, stable_vec_ns / vec_ns, static_cast<unsigned long long>(checksum));
+	}
+
+	template <typename T>
+	void compare_push_back(const char* name)
+	{
+		// best of several rounds, each filling a fresh container without reserve
+		double vec_ns = 0.0;
+		double stable_vec_ns = 0.0;
+		for (int rep = 0; rep < 5; rep++)
+		{
+			std::vector<T> vec;
+			my_adt::stable_vector<T> stable_vec;
+			double round_vec_ns = fill_ns_per_element<T>(vec);
+			double round_stable_vec_ns = fill_ns_per_element<T>(stable_vec);
+			vec_ns = rep == 0 ? round_vec_ns : std::min(vec_ns, round_vec_ns);
+			stable_vec_ns = rep == 0 ? round_stable_vec_ns : std::min(stable_vec_ns, round_stable_vec_ns);
+		}
+		std::printf("push_back %-8s  std::vector %6.3f ns/elem  stable_vector %6.3f ns/elem  ratio %5.2f\n",
+			name, vec_ns, stable_vec_ns, stable_vec_ns / vec_ns);
+	}
+
+	template <typename T, typename Append>
+	double append_ns_per_element(const std::vector<T>& batch, Append append)
+	{
+		my_adt::stable_vector<T> container;
+		auto start = std::chrono::steady_clock::now();
+		for (std::size_t appended = 0; appended < element_count; appended += batch.size())
+		{
+			append(container, batch);
+		}
+		auto stop = std::chrono::steady_clock::now();
+		return std::chrono::duration<double, std::nano>(stop - start).count() / double(container.size());
+	}
+
+	template <typename T>
+	void compare_append(const char* name)
+	{
+		// batches the size of an ingest record block, appended to one growing container
+		std::vector<T> batch;
+		fill<T>(batch);
+		batch.resize(10000);
+
+		double looped_ns = append_ns_per_element<T>(batch, [](my_adt::stable_vector<T>& container, const std::vector<T>& elems)
+		{
+			for (const T& elem : elems)
+			{
+				container.push_back(elem);
+			}
+		});
+		double bulk_ns = append_ns_per_element<T>(batch, [](my_adt::stable_vector<T>& container, const std::vector<T>& elems)
+		{
+			container.append_range(elems);
+		});
+		std::printf("append %-8s  push_back loop %6.3f ns/elem  append_range %6.3f ns/elem  ratio %5.2f\n",
+			name, looped_ns, bulk_ns, bulk_ns / looped_ns);
+	}
+
+	void compare_handle_lookup()
+	{
+		// resolving handles through a hash map of pointers, as before slot_map, against slot_map's slot table
+		my_adt::stable_vector<block64> values;
+		std::unordered_map<std::uint64_t, block64*> by_handle;
+		my_adt::slot_map<block64> slots;
+		std::vector<my_adt::slot_map_handle> handles;
+		for (std::uint64_t i = 0; i < element_count / 4; i++)
+		{
+			values.push_back(block64{{i, i, i, i, i, i, i, i}});
+			by_handle.emplace(i, &values[i]);
+			handles.push_back(slots.insert(block64{{i, i, i, i, i, i, i, i}}));
+		}
+
+		std::uint64_t checksum = 0;
+		std::size_t count = handles.size();
+		auto start = std::chrono::steady_clock::now();
+		for (int rep = 0; rep < repetitions; rep++)
+		{
+			for (std::size_t i = 0, index = 0; i < count; i++, index = (index + 4099) % count)
+			{
+				checksum += by_handle.find(index)->second->values[0];
+			}
+		}
+		auto middle = std::chrono::steady_clock::now();
+		for (int rep = 0; rep < repetitions; rep++)
+		{
+			for (std::size_t i = 0, index = 0; i < count; i++, index = (index + 4099) % count)
+			{
+				checksum += slots.find(handles[index])->values[0];
+			}
+		}
+		auto stop = std::chrono::steady_clock::now();
+
+		double lookups = double(count) * repetitions;
+		double map_ns = std::chrono::duration<double, std::nano>(middle - start).count() / lookups;
+		double slot_map_ns = std::chrono::duration<double, std::nano>(stop - middle).count() / lookups;
+		std::printf("handle lookup  unordered_map %6.3f ns  slot_map %6.3f ns  ratio %5.2f  (checksum %llu)\n",
+			map_ns, slot_map_ns, slot_map_ns / map_ns, static_cast<unsigned long long>(checksum));
+	}
+
+	// what a chunk of ints cost before the chunk directory, measured with libstdc++ on x86-64: a 56-byte vector_chunk<int>
+	// (allocator, unique_ptr with its size-tracking deleter, size and capacity) inside a std::list node with two links
+	constexpr std::size_t list_chunk_bytes = 56 + 2 * sizeof(void*);
+
+	template <typename Container>
+	void report_chunk_overhead(const char* name)
+	{
+		Container container;
+		for (std::size_t i = 0; i < element_count; i++)
+		{
+			container.push_back(static_cast<int>(i));
+		}
+
+		// each chunk now costs a directory entry plus its entry in the chunk end table
+		std::size_t chunk_count = container.chunk_count();
+		std::size_t old_bytes = chunk_count * list_chunk_bytes;
+		std::size_t metadata_bytes = container.bytes_metadata();
+		std::printf("chunk overhead %-22s  %6zu chunks  list of vector_chunk %8zu B  directory %8zu B  (%.3f%% of the int payload, was %.3f%%)\n",
+			name, chunk_count, old_bytes, metadata_bytes, 100.0 * double(metadata_bytes) / double(element_count * sizeof(int)),
+			100.0 * double(old_bytes) / double(element_count * sizeof(int)));
+	}
+
+#if defined(__linux__)
+	template <typename T>
+	void compare_contiguous(const char* name)
+	{
+		std::vector<T> vec;
+		my_adt::stable_vector<T> stable_vec;
+		my_adt::contiguous_stable_vector<T> contiguous_vec;
+
+		double fill_ns[] = {fill_ns_per_element<T>(vec), fill_ns_per_element<T>(stable_vec), fill_ns_per_element<T>(contiguous_vec)};
+
+		std::uint64_t checksum = 0;
+		double range_for_ns[] = {range_for_ns_per_element<T>(vec, checksum), range_for_ns_per_element<T>(stable_vec, checksum), range_for_ns_per_element<T>(contiguous_vec, checksum)};
+		double indexed_ns[] = {indexed_ns_per_element<T>(vec, checksum), indexed_ns_per_element<T>(stable_vec, checksum), indexed_ns_per_element<T>(contiguous_vec, checksum)};
+
+		std::printf("%-8s ns/elem      std::vector  stable_vector  contiguous_stable_vector  (checksum %llu)\n", name, static_cast<unsigned long long>(checksum));
+		std::printf("  push_back         %11.3f  %13.3f  %24.3f\n", fill_ns[0], fill_ns[1], fill_ns[2]);
+		std::printf("  range-for         %11.3f  %13.3f  %24.3f\n", range_for_ns[0], range_for_ns[1], range_for_ns[2]);
+		std::printf("  strided index     %11.3f  %13.3f  %24.3f\n", indexed_ns[0], indexed_ns[1], indexed_ns[2]);
+	}
+#endif
+}
+
+int main()
+{
+	compare_range_for<int>("int");
+	compare_range_for<block64>("64-byte");
+	compare_push_back<int>("int");
+	compare_push_back<block128>("128-byte");
+	compare_append<int>("int");
+	compare_append<block128>("128-byte");
+	compare_handle_lookup();
+	report_chunk_overhead<my_adt::stable_vector<int>>("geometric");
+	report_chunk_overhead<my_adt::stable_vector<int, std::allocator<int>, std::allocator<int*>, my_adt::fixed_chunk_growth<1024>>>("fixed 1024");
+#if defined(__linux__)
+	compare_contiguous<int>("int");
+	compare_contiguous<block64>("64-byte");
+#endif
+}
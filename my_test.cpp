@@ -1,13 +1,1379 @@
-#include <iterator>
-#include <iterator>
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <functional>
 #include <iostream>
+#include <iterator>
+#include <list>
+#include <memory>
+#include <memory_resource>
+#include <mutex>
+#include <new>
 #include <ranges>
+#include <set>
+#include <span>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
 #include "stable_vector.hpp"
 
+namespace
+{
+	// places each allocation directly below the previous one, so a later chunk can end exactly where an earlier one begins
+	struct downward_arena
+	{
+		alignas(std::max_align_t) std::byte bytes[4096];
+		std::size_t used = 0;
+	};
+
+	template <typename T>
+	struct downward_allocator
+	{
+		using value_type = T;
+
+		downward_arena* arena;
+
+		explicit downward_allocator(downward_arena* arena) noexcept : arena{arena}  {}
+		template <typename U>
+		downward_allocator(const downward_allocator<U>& other) noexcept : arena{other.arena}  {}
+
+		T* allocate(std::size_t n)
+		{
+			std::size_t bytes = (n * sizeof(T) + alignof(T) - 1) / alignof(T) * alignof(T);
+			if (arena->used + bytes > sizeof(arena->bytes))
+			{
+				throw std::bad_alloc{};
+			}
+			arena->used += bytes;
+			return reinterpret_cast<T*>(arena->bytes + sizeof(arena->bytes) - arena->used);
+		}
+
+		void deallocate(T*, std::size_t) noexcept  {}
+
+		template <typename U>
+		friend bool operator==(const downward_allocator& a, const downward_allocator<U>& b) noexcept
+		{
+			return a.arena == b.arena;
+		}
+	};
+
+	// records which allocations belong to which ledger, so memory freed through the wrong allocator is caught
+	struct allocation_ledger
+	{
+		std::set<void*> live;
+	};
+
+	template <typename T>
+	struct ledger_allocator
+	{
+		using value_type = T;
+		using propagate_on_container_swap = std::true_type;
+
+		allocation_ledger* ledger;
+
+		explicit ledger_allocator(allocation_ledger* ledger) noexcept : ledger{ledger}  {}
+		template <typename U>
+		ledger_allocator(const ledger_allocator<U>& other) noexcept : ledger{other.ledger}  {}
+
+		T* allocate(std::size_t n)
+		{
+			T* ptr = std::allocator<T>{}.allocate(n);
+			ledger->live.insert(ptr);
+			return ptr;
+		}
+
+		void deallocate(T* ptr, std::size_t n) noexcept
+		{
+			assert(ledger->live.erase(ptr) == 1);
+			std::allocator<T>{}.deallocate(ptr, n);
+		}
+
+		template <typename U>
+		friend bool operator==(const ledger_allocator& a, const ledger_allocator<U>& b) noexcept
+		{
+			return a.ledger == b.ledger;
+		}
+	};
+
+	void test_iteration_over_adjacent_chunks()
+	{
+		downward_arena arena;
+		my_adt::stable_vector<int, downward_allocator<int>> vec{downward_allocator<int>{&arena}, std::allocator<int*>{}};
+		for (int i = 0; i < 7; i++)
+		{
+			vec.push_back(i);
+
+			// each size fills the last chunk at some point, putting end() where the previous chunk begins
+			assert(vec.begin() != vec.end());
+			assert(static_cast<std::size_t>(std::ranges::distance(vec.begin(), vec.end())) == vec.size());
+			int expected = 0;
+			for (int elem : vec)
+			{
+				assert(elem == expected++);
+			}
+			assert(expected == i + 1);
+			assert(vec.rbegin() != vec.rend());
+			assert(*vec.rbegin() == i);
+		}
+	}
+
+	void test_swap_with_stateful_allocators()
+	{
+		allocation_ledger ledger_a;
+		allocation_ledger ledger_b;
+		{
+			using vector = my_adt::stable_vector<int, ledger_allocator<int>>;
+			vector a{ledger_allocator<int>{&ledger_a}, std::allocator<int*>{}};
+			vector b{ledger_allocator<int>{&ledger_b}, std::allocator<int*>{}};
+			a.append_n(100, 1);
+			b.append_n(7, 2);
+
+			// the allocators propagate on swap, so each container keeps freeing chunks through the allocator that made them
+			swap(a, b);
+			assert(a.get_allocator().ledger == &ledger_b && b.get_allocator().ledger == &ledger_a);
+			assert(a.size() == 7 && a[6] == 2 && b.size() == 100 && b[99] == 1);
+			a.append_n(1000, 3);
+			b.clear();
+		}
+		assert(ledger_a.live.empty() && ledger_b.live.empty());
+
+		// polymorphic allocators do not propagate; containers on the same resource still swap
+		std::pmr::unsynchronized_pool_resource resource;
+		my_adt::pmr::stable_vector<int> c{&resource};
+		my_adt::pmr::stable_vector<int> d{&resource};
+		c.append_n(10, 1);
+		d.append_n(3, 2);
+		swap(c, d);
+		assert(c.size() == 3 && d.size() == 10 && c.get_allocator().resource() == &resource);
+		c = d;
+		assert(c.size() == 10 && c[9] == 1);
+	}
+
+	void test_hive_get_iterator()
+	{
+		// char elements sit in slots wider than themselves, as each slot can also hold a free list node
+		my_adt::stable_hive<char> hive;
+		std::vector<char*> addresses;
+		for (int i = 0; i < 100; i++)
+		{
+			addresses.push_back(&*hive.insert(static_cast<char>(i)));
+		}
+		for (int i = 0; i < 100; i += 3)
+		{
+			hive.erase(hive.get_iterator(addresses[i]));
+		}
+		for (int i = 0; i < 100; i++)
+		{
+			if (i % 3 != 0)
+			{
+				auto pos = hive.get_iterator(addresses[i]);
+				assert(pos != hive.end() && &*pos == addresses[i] && *pos == static_cast<char>(i));
+			}
+		}
+		char outside = 0;
+		assert(hive.get_iterator(&outside) == hive.end());
+
+		// an erased slot still lies inside its chunk, but no longer names an element
+		assert(hive.get_iterator(addresses[0]) == hive.end() && hive.get_iterator(addresses[99]) == hive.end());
+		auto reused = hive.insert('x');
+		assert(hive.get_iterator(&*reused) == reused);
+	}
+
+	void test_hive_swap_and_assign_with_pmr()
+	{
+		std::pmr::unsynchronized_pool_resource resource;
+		my_adt::pmr::stable_hive<int> a{&resource};
+		my_adt::pmr::stable_hive<int> b{&resource};
+		for (int i = 0; i < 50; i++)
+		{
+			a.insert(i);
+		}
+		b.insert(-1);
+		swap(a, b);
+		assert(a.size() == 1 && b.size() == 50 && a.get_allocator().resource() == &resource);
+
+		// a copy from another resource is taken over element by element, keeping the target's resource
+		std::pmr::unsynchronized_pool_resource other_resource;
+		my_adt::pmr::stable_hive<int> c{&other_resource};
+		c = b;
+		assert(c.size() == 50 && c.get_allocator().resource() == &other_resource);
+		c = std::move(a);
+		assert(c.size() == 1 && *c.begin() == -1 && c.get_allocator().resource() == &other_resource);
+
+		my_adt::stable_hive<int> d;
+		my_adt::stable_hive<int> e;
+		d.insert(1);
+		e = d;
+		e = std::move(d);
+		assert(e.size() == 1 && *e.begin() == 1);
+
+		// elements are built through the allocator, so they allocate from the hive's resource, including in reused slots
+		my_adt::pmr::stable_hive<std::pmr::string> strings{&resource};
+		for (int i = 0; i < 20; i++)
+		{
+			strings.insert(std::pmr::string(100, 's'));
+		}
+		strings.erase(strings.begin());
+		strings.emplace(100, 't');
+		for (const std::pmr::string& str : strings)
+		{
+			assert(str.get_allocator().resource() == &resource);
+		}
+	}
+
+	void test_slot_map_reuse_after_move()
+	{
+		my_adt::slot_map<std::string> source;
+		my_adt::slot_map_handle first = source.insert("first");
+		my_adt::slot_map_handle second = source.insert("second");
+		source.erase(first);
+
+		// the free list moves along with the slots, so the source starts over without one
+		my_adt::slot_map<std::string> moved{std::move(source)};
+		assert(moved.size() == 1 && moved[second] == "second" && !moved.contains(first));
+		assert(source.empty() && !source.contains(second));
+		my_adt::slot_map_handle reused = source.insert("again");
+		assert(source.size() == 1 && source[reused] == "again");
+
+		my_adt::slot_map<std::string> assigned;
+		assigned.insert("replaced");
+		moved.erase(second);
+		assigned = std::move(moved);
+		assert(assigned.empty());
+		moved.insert("again");
+		assert(moved.size() == 1);
+		my_adt::slot_map_handle third = assigned.insert("third");
+		assert(assigned[third] == "third" && !assigned.contains(second));
+	}
+
+	void test_small_vector_fills_inline_buffer_first()
+	{
+		// a first request larger than the inline buffer still starts in it, with only the rest allocated
+		my_adt::small_stable_vector<int, 8> reserved;
+		reserved.reserve(100);
+		assert(reserved.capacity() == 100);
+		my_adt::stable_vector_memory_stats stats = reserved.memory_stats();
+		assert(stats.chunk_count == 2 && stats.chunks[0].is_inline && stats.chunks[0].capacity == 8);
+		assert(stats.bytes_allocated == 92 * sizeof(int));
+
+		my_adt::small_stable_vector<int, 8> overwritten;
+		std::span<int> first = overwritten.grow_for_overwrite(20);
+		assert(first.size() == 8 && overwritten.memory_stats().chunks[0].is_inline);
+
+		// lookups past the inline chunk, with and without a reserve breaking the growth pattern
+		my_adt::small_stable_vector<int, 8> grown;
+		for (int i = 0; i < 5000; i++)
+		{
+			grown.push_back(i);
+			reserved.push_back(i);
+		}
+		for (int i = 0; i < 5000; i++)
+		{
+			assert(grown[i] == i && reserved[i] == i);
+			assert(*(grown.begin() + i) == i && *(reserved.begin() + i) == i);
+		}
+	}
+
+	void test_nested_parallel_calls()
+	{
+		// outer tasks that land on the calling thread start a job of their own, which must run inline instead of waiting
+		// for the job they are part of
+		my_adt::detail::thread_pool pool{4};
+		std::atomic<std::size_t> inner_tasks{0};
+		auto inner = [&](std::size_t) { inner_tasks.fetch_add(1, std::memory_order_relaxed); };
+		auto outer = [&](std::size_t) { pool.run(8, inner); };
+		for (int rep = 0; rep < 100; rep++)
+		{
+			pool.run(8, outer);
+		}
+		assert(inner_tasks.load() == 100 * 8 * 8);
+
+		my_adt::stable_vector<int> vec;
+		vec.resize(50000, 1);
+		std::atomic<long long> total{0};
+		my_adt::for_each(my_adt::execution::par, vec.begin(), vec.begin() + 20000, [&](int)
+		{
+			total.fetch_add(my_adt::reduce(my_adt::execution::par, vec.begin(), vec.begin() + 10, 0LL), std::memory_order_relaxed);
+		});
+		assert(total.load() == 20000 * 10);
+	}
+
+	void test_indexed_access()
+	{
+		my_adt::stable_vector<int> vec;
+		for (int i = 0; i < 3000; i++)
+		{
+			vec.push_back(i);
+		}
+		for (int i = 0; i < 3000; i++)
+		{
+			assert(vec[i] == i && vec.at(i) == i && *vec.data_at(i) == i);
+			assert(&vec[i] == vec.data_at(i));
+		}
+
+		const my_adt::stable_vector<int>& const_vec = vec;
+		assert(const_vec[2999] == 2999 && const_vec.at(0) == 0);
+		bool threw = false;
+		try
+		{
+			(void)vec.at(3000);
+		}
+		catch (const std::out_of_range&)
+		{
+			threw = true;
+		}
+		assert(threw);
+	}
+
+	static_assert(std::random_access_iterator<my_adt::stable_vector<int>::iterator>);
+	static_assert(std::random_access_iterator<my_adt::stable_vector<int>::const_iterator>);
+	static_assert(std::random_access_iterator<my_adt::stable_vector<int>::reverse_iterator>);
+
+	void test_random_access_iterators()
+	{
+		my_adt::stable_vector<int> vec;
+		for (int i = 0; i < 1000; i++)
+		{
+			vec.push_back(i);
+		}
+
+		// jumps across any number of chunk boundaries in both directions
+		for (int from = 0; from <= 1000; from += 37)
+		{
+			for (int to = 0; to <= 1000; to += 41)
+			{
+				auto it = vec.begin() + from;
+				it += to - from;
+				assert(it - vec.begin() == to && (vec.begin() + to) - (vec.begin() + from) == to - from);
+				assert((from < to) == (vec.begin() + from < vec.begin() + to));
+				if (to < 1000)
+				{
+					assert(*it == to && vec.begin()[to] == to);
+				}
+			}
+		}
+		assert(std::distance(vec.cbegin(), vec.cend()) == 1000);
+		assert(*(vec.rbegin() + 10) == 989 && vec.rend() - vec.rbegin() == 1000);
+		assert(*(vec.end() - 1) == 999 && *std::prev(vec.cend()) == 999);
+	}
+
+	void test_segments()
+	{
+		my_adt::stable_vector<int> vec;
+		assert(std::ranges::distance(vec.segments()) == 0);
+		for (int i = 0; i < 1000; i++)
+		{
+			vec.push_back(i);
+		}
+
+		// the spans cover the elements in order, one per non-empty chunk
+		int expected = 0;
+		std::size_t segment_count = 0;
+		for (std::span<int> segment : vec.segments())
+		{
+			assert(!segment.empty());
+			for (int elem : segment)
+			{
+				assert(elem == expected++);
+			}
+			segment_count++;
+		}
+		assert(expected == 1000 && segment_count == vec.chunk_count());
+
+		long long total = 0;
+		std::as_const(vec).for_each_segment([&](std::span<const int> segment)
+		{
+			for (int elem : segment)
+			{
+				total += elem;
+			}
+		});
+		assert(total == 999LL * 1000 / 2);
+	}
+
+	void test_segment_algorithms()
+	{
+		my_adt::stable_vector<int> vec;
+		vec.resize(1000);
+		my_adt::fill(vec.begin(), vec.end(), 1);
+		assert(my_adt::accumulate(vec.cbegin(), vec.cend(), 0) == 1000);
+
+		int next = 0;
+		my_adt::for_each(vec.begin(), vec.end(), [&](int& elem) { elem = next++; });
+		my_adt::stable_vector<int> doubled;
+		doubled.resize(1000);
+		my_adt::transform(vec.cbegin(), vec.cend(), doubled.begin(), [](int elem) { return elem * 2; });
+		assert(doubled[999] == 1998);
+
+		// subranges starting and ending inside chunks
+		assert(my_adt::accumulate(vec.cbegin() + 3, vec.cend() - 3, 0) == 999 * 1000 / 2 - (0 + 1 + 2) - (997 + 998 + 999));
+		assert(my_adt::find(vec.cbegin(), vec.cend(), 700) - vec.cbegin() == 700);
+		assert(my_adt::find(vec.cbegin() + 701, vec.cend(), 700) == vec.cend());
+		assert(my_adt::count_if(vec.cbegin(), vec.cend(), [](int elem) { return elem % 10 == 0; }) == 100);
+
+		std::vector<int> copied(1000);
+		my_adt::copy(vec.cbegin(), vec.cend(), copied.begin());
+		assert(copied[500] == 500);
+		assert(my_adt::equal(vec.cbegin(), vec.cend(), copied.begin()));
+		copied[999] = -1;
+		assert(!my_adt::equal(vec.cbegin(), vec.cend(), copied.begin()));
+	}
+
+	void test_simd_kernels()
+	{
+		// lengths around the vector width leave scalar tails in every chunk
+		for (int n : {1, 7, 33, 1000})
+		{
+			my_adt::stable_vector<int> ints;
+			my_adt::stable_vector<double> doubles;
+			for (int i = 0; i < n; i++)
+			{
+				int value = (i * 7919) % n - n / 2;
+				ints.push_back(value);
+				doubles.push_back(value * 0.5);
+			}
+
+			long long sum = 0;
+			int min = ints[0];
+			int max = ints[0];
+			std::size_t zeros = 0;
+			for (int elem : ints)
+			{
+				sum += elem;
+				min = std::min(min, elem);
+				max = std::max(max, elem);
+				zeros += elem == 0;
+			}
+			assert(ints.sum() == sum && ints.min() == min && ints.max() == max);
+			assert(ints.minmax() == std::make_pair(min, max));
+			assert(ints.count(0) == zeros);
+			assert(doubles.sum() == sum * 0.5 && doubles.min() == min * 0.5 && doubles.max() == max * 0.5);
+
+			assert(*ints.find(max) == max && ints.find(max + 1) == ints.end());
+			assert(ints.find(ints[n - 1]) - ints.begin() <= n - 1);
+			assert(*doubles.find(min * 0.5) == min * 0.5);
+		}
+	}
+
+	void test_parallel_algorithms()
+	{
+		my_adt::stable_vector<int> vec;
+		vec.resize(100000);
+		my_adt::for_each(my_adt::execution::par, vec.begin(), vec.end(), [](int& elem) { elem = 1; });
+		assert(my_adt::reduce(my_adt::execution::par, vec.cbegin(), vec.cend(), 0LL) == 100000);
+
+		int next = 0;
+		my_adt::for_each(my_adt::execution::seq, vec.begin(), vec.end(), [&](int& elem) { elem = next++; });
+		my_adt::stable_vector<long long> squares;
+		squares.resize(vec.size());
+		my_adt::transform(my_adt::execution::par_unseq, vec.cbegin(), vec.cend(), squares.begin(), [](int elem) { return 1LL * elem * elem; });
+		assert(squares[99999] == 99999LL * 99999);
+
+		// partitions that start and end inside chunks
+		long long expected = 0;
+		for (int i = 10; i < 99990; i++)
+		{
+			expected += 2LL * i;
+		}
+		assert(my_adt::transform_reduce(my_adt::execution::par, vec.cbegin() + 10, vec.cend() - 10, 0LL, std::plus<>{}, [](int elem) { return 2LL * elem; }) == expected);
+		assert(my_adt::reduce(my_adt::execution::par, vec.cbegin(), vec.cbegin(), 5LL) == 5);
+	}
+
+	void test_reserve()
+	{
+		my_adt::stable_vector<long> vec;
+		vec.reserve(1000);
+		assert(vec.capacity() == 1000 && vec.chunk_count() == 1);
+		for (long i = 0; i < 1000; i++)
+		{
+			vec.push_back(i);
+		}
+		assert(vec.capacity() == 1000 && vec.chunk_count() == 1);
+
+		// growth resumes past the reserved chunk, and reserve_extra counts from the size
+		vec.push_back(1000);
+		assert(vec.capacity() > 1000);
+		vec.reserve_extra(5000);
+		assert(vec.capacity() == 6001);
+		vec.reserve(10);
+		assert(vec.capacity() == 6001);
+		for (long i = 1001; i < 6001; i++)
+		{
+			vec.push_back(i);
+		}
+		assert(vec.capacity() == 6001);
+		for (long i = 0; i < 6001; i++)
+		{
+			assert(vec[i] == i);
+		}
+	}
+
+	template <typename Vector>
+	void check_growth_policy(std::size_t expected_chunks, std::size_t expected_capacity)
+	{
+		Vector vec;
+		for (int i = 0; i < 5000; i++)
+		{
+			vec.push_back(i);
+		}
+		assert(vec.chunk_count() == expected_chunks && vec.capacity() == expected_capacity);
+		for (int i = 0; i < 5000; i++)
+		{
+			assert(vec[i] == i && *(vec.begin() + i) == i);
+		}
+	}
+
+	void test_growth_policies()
+	{
+		using my_adt::stable_vector;
+		check_growth_policy<stable_vector<int>>(14, 8192);
+		check_growth_policy<stable_vector<int, std::allocator<int>, std::allocator<int*>, my_adt::fixed_chunk_growth<100>>>(50, 5000);
+		// doubling up to 4 KiB chunks of 1024 ints, then four more of those
+		check_growth_policy<stable_vector<int, std::allocator<int>, std::allocator<int*>, my_adt::capped_geometric_growth<4096>>>(15, 5120);
+		check_growth_policy<stable_vector<int, std::allocator<int>, std::allocator<int*>, my_adt::geometric_growth<3, 2>>>(22, 5395);
+
+		static_assert(my_adt::growth_policy<my_adt::fixed_chunk_growth<100>>);
+		static_assert(my_adt::indexed_growth_policy<my_adt::geometric_growth<>>);
+		static_assert(!my_adt::indexed_growth_policy<my_adt::geometric_growth<3, 2>>);
+	}
+
+	void test_retained_capacity()
+	{
+		my_adt::stable_vector<std::string> vec;
+		vec.retain_capacity();
+		for (int round = 0; round < 3; round++)
+		{
+			for (int i = 0; i < 1000; i++)
+			{
+				vec.push_back(std::to_string(i));
+			}
+			const std::string* first = &vec[0];
+			vec.clear();
+
+			// cleared chunks stay, so the next round refills the same buffers
+			assert(vec.empty() && vec.capacity() == 1024 && vec.begin() == vec.end());
+			vec.push_back("again");
+			assert(&vec[0] == first);
+			vec.clear();
+		}
+
+		vec.retain_capacity(100);
+		assert(vec.retained_capacity_limit() == 100);
+		vec.clear();
+		assert(vec.capacity() == 64);
+
+		// pop_back keeps emptied chunks until release_unused()
+		for (int i = 0; i < 300; i++)
+		{
+			vec.push_back("y");
+		}
+		while (vec.size() > 5)
+		{
+			vec.pop_back();
+		}
+		assert(vec.capacity() == 512);
+		vec.release_unused();
+		assert(vec.capacity() == 8 && vec.size() == 5 && vec[4] == "y");
+	}
+
+	void test_aligned_allocator()
+	{
+		my_adt::stable_vector<double, my_adt::aligned_allocator<double>> vec;
+		my_adt::stable_vector<char, my_adt::aligned_allocator<char, 4096>> page_aligned;
+		for (int i = 0; i < (1 << 19); i++)
+		{
+			vec.push_back(i);
+			page_aligned.push_back('a');
+		}
+
+		for (std::span<double> segment : vec.segments())
+		{
+			std::uintptr_t address = reinterpret_cast<std::uintptr_t>(segment.data());
+			assert(address % 64 == 0);
+			// chunks of a huge page or more start on a huge page boundary
+			if (segment.size() * sizeof(double) >= my_adt::aligned_allocator<double>::huge_page_size)
+			{
+				assert(address % my_adt::aligned_allocator<double>::huge_page_size == 0);
+			}
+		}
+		for (std::span<char> segment : page_aligned.segments())
+		{
+			assert(reinterpret_cast<std::uintptr_t>(segment.data()) % 4096 == 0);
+		}
+		assert(vec.sum() == double(1 << 19) * ((1 << 19) - 1) / 2);
+	}
+
+#if defined(__linux__)
+	void test_contiguous_stable_vector()
+	{
+		my_adt::contiguous_stable_vector<std::string> vec(100000);
+		vec.push_back("first");
+		const std::string* first = vec.data();
+		for (int i = 1; i < 100000; i++)
+		{
+			vec.emplace_back(std::to_string(i));
+		}
+
+		// growing commits more of the reserved range, so elements stay put and stay contiguous
+		assert(vec.data() == first && &vec[99999] == first + 99999);
+		assert(vec.span().size() == 100000 && vec.span()[99999] == "99999");
+		bool threw = false;
+		try
+		{
+			vec.push_back("past max_size");
+		}
+		catch (const std::length_error&)
+		{
+			threw = true;
+		}
+		assert(threw && vec.size() == 100000);
+
+		my_adt::contiguous_stable_vector<std::string> copy = vec;
+		assert(copy.size() == vec.size() && copy[500] == "500" && copy.data() != vec.data());
+		while (vec.size() > 10)
+		{
+			vec.pop_back();
+		}
+		std::size_t capacity = vec.capacity();
+		vec.release_unused();
+		assert(vec.capacity() < capacity && vec.capacity() >= 10);
+		vec.push_back("again");
+		assert(vec[10] == "again" && vec.data() == first);
+
+		my_adt::contiguous_stable_vector<std::string> moved = std::move(vec);
+		assert(moved.size() == 11 && moved.data() == first && vec.empty());
+		assert(std::distance(moved.crbegin(), moved.crend()) == 11);
+	}
+#else
+	void test_contiguous_stable_vector()  {}
+#endif
+
+#if defined(__linux__)
+	struct mapped_record
+	{
+		long id;
+		double value;
+	};
+
+	void test_mapped_stable_vector()
+	{
+		std::string path = (std::filesystem::temp_directory_path() / "my_test_mapped_stable_vector.bin").string();
+		std::filesystem::remove(path);
+		{
+			my_adt::mapped_stable_vector<mapped_record> vec(path.c_str(), 1 << 20);
+			assert(vec.empty());
+			vec.push_back({0, 0.0});
+			const mapped_record* first = vec.data();
+			for (long i = 1; i < 100000; i++)
+			{
+				vec.emplace_back(i, i * 0.5);
+			}
+			assert(vec.data() == first && vec.size() == 100000);
+			vec.flush();
+		}
+
+		// a reopened file holds what was written, and shrinking persists too
+		{
+			my_adt::mapped_stable_vector<mapped_record> vec(path.c_str(), 1 << 20);
+			assert(vec.size() == 100000);
+			for (long i = 0; i < 100000; i++)
+			{
+				assert(vec[i].id == i && vec[i].value == i * 0.5);
+			}
+			while (vec.size() > 1000)
+			{
+				vec.pop_back();
+			}
+			vec.release_unused();
+			vec.push_back({-1, -1.0});
+		}
+		{
+			my_adt::mapped_stable_vector<mapped_record> vec(path.c_str());
+			assert(vec.size() == 1001 && vec.at(1000).id == -1);
+		}
+
+		// a host with smaller pages may have left the file ending partway into one of ours
+		std::filesystem::resize_file(path, (1 << 16) + 1001 * sizeof(mapped_record));
+		{
+			my_adt::mapped_stable_vector<mapped_record> vec(path.c_str());
+			assert(vec.size() == 1001 && vec.capacity() == 1001 && vec[999].id == 999);
+			vec.reserve(100000);
+			assert(vec[999].id == 999 && vec.at(1000).id == -1);
+
+			// a moved-from container is empty; clearing it does nothing and growing it throws
+			my_adt::mapped_stable_vector<mapped_record> moved{std::move(vec)};
+			vec.clear();
+			assert(vec.empty() && moved.size() == 1001);
+			bool threw = false;
+			try
+			{
+				vec.push_back({0, 0.0});
+			}
+			catch (const std::logic_error&)
+			{
+				threw = true;
+			}
+			assert(threw);
+		}
+
+		// files are checked against the element type and the requested size
+		bool threw = false;
+		try
+		{
+			my_adt::mapped_stable_vector<int> wrong_type(path.c_str());
+		}
+		catch (const std::runtime_error&)
+		{
+			threw = true;
+		}
+		assert(threw);
+		threw = false;
+		try
+		{
+			my_adt::mapped_stable_vector<mapped_record> too_small(path.c_str(), 10);
+		}
+		catch (const std::length_error&)
+		{
+			threw = true;
+		}
+		assert(threw);
+
+		// as is a file whose header puts the elements somewhere else
+		{
+			const std::uint64_t page_sized_header[] = {0x3250414d43455653, sizeof(int), alignof(int), 4096, 0};
+			std::filesystem::remove(path);
+			std::ofstream file{path, std::ios::binary};
+			file.write(reinterpret_cast<const char*>(page_sized_header), sizeof(page_sized_header));
+		}
+		std::filesystem::resize_file(path, 1 << 16);
+		threw = false;
+		try
+		{
+			my_adt::mapped_stable_vector<int> other_layout(path.c_str());
+		}
+		catch (const std::runtime_error&)
+		{
+			threw = true;
+		}
+		assert(threw);
+		std::filesystem::remove(path);
+	}
+#else
+	void test_mapped_stable_vector()  {}
+#endif
+
+	void test_pmr_arena()
+	{
+		// with no upstream, anything not served from the buffer would throw
+		alignas(std::max_align_t) static std::byte buffer[1 << 16];
+		std::pmr::monotonic_buffer_resource arena{buffer, sizeof(buffer), std::pmr::null_memory_resource()};
+		{
+			my_adt::pmr::stable_vector<int> vec{&arena};
+			my_adt::pmr::small_stable_vector<int, 4> small{&arena};
+			for (int i = 0; i < 1000; i++)
+			{
+				vec.push_back(i);
+				small.push_back(i);
+			}
+			for (std::span<int> segment : vec.segments())
+			{
+				assert(std::less_equal<const void*>{}(buffer, segment.data()) && std::less<const void*>{}(segment.data(), buffer + sizeof(buffer)));
+			}
+			assert(vec.get_allocator().resource() == &arena && small[999] == 999);
+
+			// polymorphic allocators do not propagate on copy, so the copy is given the arena explicitly
+			my_adt::pmr::stable_vector<int> copy{vec, std::pmr::polymorphic_allocator<int>{&arena}};
+			assert(copy.get_allocator().resource() == &arena && copy[500] == 500);
+		}
+		arena.release();
+	}
+
+	void test_memory_stats()
+	{
+		my_adt::stable_vector<int> vec;
+		for (int i = 0; i < 100; i++)
+		{
+			vec.push_back(i);
+		}
+
+		// chunks of 1, 1, 2, ..., 64 elements, the last one holding 36
+		my_adt::stable_vector_memory_stats stats = vec.memory_stats();
+		assert(stats.size == 100 && stats.capacity == 128 && stats.chunk_count == 8 && vec.chunk_count() == 8);
+		assert(stats.bytes_allocated == 128 * sizeof(int) && vec.bytes_allocated() == stats.bytes_allocated);
+		assert(stats.bytes_slack == 28 * sizeof(int) && vec.bytes_slack() == stats.bytes_slack);
+		assert(stats.bytes_metadata >= 8 * (sizeof(int*) + sizeof(std::size_t)) && vec.bytes_metadata() == stats.bytes_metadata);
+		assert(stats.chunks.size() == 8 && stats.chunks[7].first_index == 64 && stats.chunks[7].capacity == 64 && stats.chunks[7].size == 36);
+		assert(!stats.chunks[0].is_inline);
+
+		my_adt::small_stable_vector<int, 4> small;
+		small.push_back(1);
+		assert(small.memory_stats().chunks[0].is_inline && small.bytes_allocated() == 0 && small.bytes_slack() == 0);
+	}
+
+	// neither copyable nor movable, so it can only be constructed where it will live
+	struct pinned
+	{
+		std::mutex mutex;
+		int value;
+
+		explicit pinned(int value) : value{value}  {}
+	};
+
+	void test_emplace_immovable()
+	{
+		my_adt::stable_vector<pinned> vec;
+		for (int i = 0; i < 100; i++)
+		{
+			pinned& elem = vec.emplace_back(i);
+			assert(&elem == &vec[i] && elem.value == i);
+		}
+		vec.pop_back();
+		assert(vec.size() == 99 && vec[98].value == 98);
+
+		// an argument referring into the container stays valid while the next chunk is allocated
+		my_adt::stable_vector<std::string> strings;
+		strings.emplace_back(5, 'x');
+		for (int i = 0; i < 20; i++)
+		{
+			strings.emplace_back(strings[strings.size() - 1]);
+		}
+		assert(strings.size() == 21 && strings[20] == "xxxxx");
+	}
+
+	void test_bulk_appends()
+	{
+		std::vector<int> batch(1000);
+		for (int i = 0; i < 1000; i++)
+		{
+			batch[i] = i;
+		}
+
+		// the free tail of the current chunk is filled first, and the rest goes into a single new chunk
+		my_adt::stable_vector<int> vec;
+		vec.push_back(-1);
+		vec.push_back(-2);
+		vec.push_back(-3);
+		std::size_t chunks = vec.chunk_count();
+		vec.append_range(batch);
+		assert(vec.size() == 1003 && vec.chunk_count() == chunks + 1);
+		assert(vec[2] == -3 && vec[3] == 0 && vec[1002] == 999);
+
+		std::list<int> list{1, 2, 3};
+		vec.append(list.begin(), list.end());
+		vec.append_n(5, 7);
+		assert(vec.size() == 1011 && vec[1005] == 3 && vec[1010] == 7);
+
+		// input ranges of unknown length are appended one element at a time
+		std::istringstream input{"4 5 6"};
+		vec.append(std::istream_iterator<int>{input}, std::istream_iterator<int>{});
+		assert(vec.size() == 1014 && vec[1013] == 6);
+
+		my_adt::small_stable_vector<std::string, 4> small;
+		small.append_n(10, "s");
+		assert(small.size() == 10 && small.memory_stats().chunks[0].is_inline && small[9] == "s");
+	}
+
+	void test_overwrite_appends()
+	{
+		my_adt::stable_vector<char> vec;
+		const char text[] = "stable";
+
+		// grow_for_overwrite stays within one chunk, so callers loop until everything is written
+		std::size_t written = 0;
+		while (written < 6)
+		{
+			std::span<char> dest = vec.grow_for_overwrite(6 - written);
+			assert(!dest.empty() && dest.size() <= 6 - written);
+			std::memcpy(dest.data(), text + written, dest.size());
+			written += dest.size();
+		}
+		assert(vec.size() == 6 && std::equal(vec.cbegin(), vec.cend(), text));
+		assert(vec.grow_for_overwrite(0).empty());
+		vec.push_back('!');
+
+		// append_uninitialized hands out one span per chunk it touches, covering exactly n elements
+		std::size_t pieces = 0;
+		char next = 'a';
+		vec.append_uninitialized(1000, [&](std::span<char> dest)
+		{
+			for (char& elem : dest)
+			{
+				elem = next;
+				next = next == 'z' ? 'a' : next + 1;
+			}
+			pieces++;
+		});
+		assert(vec.size() == 1007 && pieces == 2 && vec[6] == '!' && vec[7] == 'a' && vec[32] == 'z' && vec[33] == 'a');
+
+		// polymorphic_allocator constructs elements itself, so they are value-initialized through it
+		std::pmr::monotonic_buffer_resource arena;
+		my_adt::pmr::stable_vector<int> ints{&arena};
+		std::span<int> first = ints.grow_for_overwrite(8);
+		ints.append_uninitialized(100, [](std::span<int> dest)
+		{
+			assert(std::all_of(dest.begin(), dest.end(), [](int elem) { return elem == 0; }));
+		});
+		assert(ints.size() == 108 && std::all_of(first.begin(), first.end(), [](int elem) { return elem == 0; }));
+	}
+
+	void test_resize_and_truncate()
+	{
+		my_adt::stable_vector<std::string> vec;
+		vec.resize(10);
+		assert(vec.size() == 10 && vec[9].empty());
+		vec.resize(1000, "v");
+		assert(vec.size() == 1000 && vec[9].empty() && vec[10] == "v" && vec[999] == "v");
+
+		// each resize grew by one chunk, and shrinking frees those past the new size
+		vec.resize(5);
+		assert(vec.size() == 5 && vec.capacity() == 10);
+		vec.truncate(100);
+		assert(vec.size() == 5);
+		vec.truncate(0);
+		assert(vec.empty() && vec.capacity() == 0);
+
+		// except those kept by retain_capacity()
+		vec.retain_capacity(64);
+		for (int i = 0; i < 1000; i++)
+		{
+			vec.push_back("w");
+		}
+		vec.truncate(3);
+		assert(vec.size() == 3 && vec.capacity() == 64 && vec[2] == "w");
+
+		my_adt::stable_vector<int> ints;
+		ints.resize_for_overwrite(100);
+		assert(ints.size() == 100);
+		ints[99] = 99;
+		ints.resize(200);
+		assert(ints[99] == 99 && ints[199] == 0);
+
+		// growth constructs through the allocator, so pmr elements share the container's resource
+		std::pmr::monotonic_buffer_resource arena;
+		my_adt::pmr::stable_vector<std::pmr::string> strings{&arena};
+		strings.resize(10);
+		strings.resize(20, std::pmr::string(100, 'z'));
+		for (std::pmr::string& str : strings)
+		{
+			assert(str.get_allocator().resource() == &arena);
+		}
+		assert(strings[9].empty() && strings[19].size() == 100);
+
+		my_adt::pmr::stable_vector<int> pmr_ints{&arena};
+		pmr_ints.resize_for_overwrite(50);
+		pmr_ints[49] = 49;
+		assert(pmr_ints.size() == 50 && pmr_ints[49] == 49);
+	}
+
+	static_assert(std::bidirectional_iterator<my_adt::stable_hive<int>::iterator>);
+	static_assert(std::bidirectional_iterator<my_adt::stable_hive<int>::const_iterator>);
+
+	void test_hive()
+	{
+		my_adt::stable_hive<int> hive;
+		std::vector<int*> addresses;
+		for (int i = 0; i < 16; i++)
+		{
+			addresses.push_back(&*hive.insert(i));
+		}
+
+		// erasing leaves runs of holes that iteration skips in both directions; other elements keep their addresses
+		for (int i : {3, 5, 4, 0, 15, 14, 1, 2, 7})
+		{
+			auto pos = hive.get_iterator(addresses[i]);
+			auto next = std::next(pos);
+			assert(hive.erase(pos) == next);
+		}
+		assert(hive.size() == 7);
+		assert(std::vector<int>(hive.begin(), hive.end()) == (std::vector<int>{6, 8, 9, 10, 11, 12, 13}));
+		std::vector<int> reversed;
+		for (auto it = hive.end(); it != hive.begin();)
+		{
+			reversed.push_back(*--it);
+		}
+		assert(reversed == (std::vector<int>{13, 12, 11, 10, 9, 8, 6}));
+		assert(*addresses[6] == 6 && *addresses[13] == 13);
+
+		// inserts fill the holes before the container grows
+		for (int i = 0; i < 9; i++)
+		{
+			hive.insert(100 + i);
+		}
+		assert(hive.size() == 16 && hive.capacity() == 16);
+		hive.insert(200);
+		assert(hive.size() == 17 && hive.capacity() > 16);
+
+		my_adt::stable_hive<int> copy = hive;
+		assert(copy.size() == 17 && std::count(copy.begin(), copy.end(), 200) == 1);
+		for (auto it = hive.begin(); it != hive.end();)
+		{
+			it = hive.erase(it);
+		}
+		assert(hive.empty() && hive.begin() == hive.end() && copy.size() == 17);
+		hive.clear();
+		assert(hive.capacity() == 0);
+	}
+
+	void test_slot_map()
+	{
+		my_adt::slot_map<std::string> map;
+		std::vector<my_adt::slot_map_handle> handles;
+		for (int i = 0; i < 100; i++)
+		{
+			handles.push_back(map.emplace(3, static_cast<char>('a' + i % 26)));
+		}
+
+		// erase moves the last element into the hole; every remaining handle still resolves to its own element
+		for (int i = 0; i < 100; i += 3)
+		{
+			assert(map.erase(handles[i]));
+			assert(!map.erase(handles[i]));
+		}
+		assert(map.size() == 66);
+		for (int i = 0; i < 100; i++)
+		{
+			assert(map.contains(handles[i]) == (i % 3 != 0));
+			if (i % 3 != 0)
+			{
+				assert(map[handles[i]] == std::string(3, static_cast<char>('a' + i % 26)));
+			}
+		}
+
+		// reused slots get a new generation, so the old handles stay stale
+		my_adt::slot_map_handle reused = map.insert("reused");
+		assert(reused.index == handles[99].index && reused != handles[99]);
+		assert(map.find(handles[99]) == nullptr && map.at(reused) == "reused");
+		bool threw = false;
+		try
+		{
+			map.at(handles[0]);
+		}
+		catch (const std::out_of_range&)
+		{
+			threw = true;
+		}
+		assert(threw);
+
+		// dense positions and handles agree, both through the iterators and through segments
+		std::size_t position = 0;
+		for (const std::string& val : map)
+		{
+			assert(&map[map.handle_at(position)] == &val);
+			position++;
+		}
+		std::size_t segment_total = 0;
+		for (auto segment : map.segments())
+		{
+			segment_total += std::ranges::size(segment);
+		}
+		assert(position == map.size() && segment_total == map.size());
+
+		// a copy resolves the same handles to its own elements
+		const my_adt::slot_map<std::string> copy = map;
+		assert(copy.size() == map.size() && copy[reused] == "reused" && &copy[reused] != &map[reused]);
+		map.clear();
+		assert(map.empty() && !map.contains(reused) && !map.contains(handles[1]));
+		assert(copy.contains(handles[1]) && copy.at(handles[1]) == "bbb");
+	}
+
+	void test_pmr_elements_use_the_arena()
+	{
+		// long enough to allocate, so every element is checked for holding memory from the arena rather than the default resource
+		const std::pmr::string text(100, 'x');
+		std::pmr::monotonic_buffer_resource arena;
+		std::pmr::polymorphic_allocator<std::pmr::string> allocator{&arena};
+		auto in_arena = [&arena](auto& vec)
+		{
+			return std::all_of(vec.begin(), vec.end(), [&arena](const std::pmr::string& str) { return str.get_allocator().resource() == &arena; });
+		};
+
+		std::pmr::string texts[] = {text, text, text};
+		my_adt::pmr::stable_vector<std::pmr::string> from_iterators{std::begin(texts), std::end(texts), allocator};
+		my_adt::pmr::stable_vector<std::pmr::string> from_list{{text, text}, allocator};
+		my_adt::pmr::stable_vector<std::pmr::string> from_range{std::from_range, texts, allocator};
+		my_adt::pmr::stable_vector<std::pmr::string> sized{5, allocator};
+		assert(in_arena(from_iterators) && in_arena(from_list) && in_arena(from_range) && in_arena(sized) && from_range[2] == text);
+
+		my_adt::pmr::stable_vector<std::pmr::string> source;
+		for (int i = 0; i < 10; i++)
+		{
+			source.push_back(text);
+		}
+		my_adt::pmr::stable_vector<std::pmr::string> copied{source, allocator};
+		my_adt::pmr::stable_vector<std::pmr::string> moved{std::move(source), allocator};
+		assert(in_arena(copied) && in_arena(moved) && moved.size() == 10 && moved[9] == text);
+
+		// moving a small vector relocates its inline elements, which must keep the arena too
+		my_adt::pmr::small_stable_vector<std::pmr::string, 4> small{allocator};
+		small.push_back(text);
+		small.push_back(text);
+		my_adt::pmr::small_stable_vector<std::pmr::string, 4> small_moved{std::move(small)};
+		assert(in_arena(small_moved) && small_moved[1] == text);
+	}
+
+	void test_pmr_appends_use_the_arena()
+	{
+		const std::pmr::string text(100, 'y');
+		std::pmr::monotonic_buffer_resource arena;
+		my_adt::pmr::stable_vector<std::pmr::string> vec{&arena};
+		std::pmr::string texts[] = {text, text, text};
+		std::list<std::pmr::string> listed{text, text};
+
+		// the sized range fills the free tail of a chunk and then one new chunk, both through the allocator
+		vec.push_back(text);
+		vec.append_range(texts);
+		vec.append(listed.begin(), listed.end());
+		vec.append_n(20, text);
+		vec.append_range(texts | std::views::filter([](const std::pmr::string& str) { return !str.empty(); }));
+		assert(vec.size() == 29 && vec[28] == text);
+		for (std::pmr::string& str : vec)
+		{
+			assert(str.get_allocator().resource() == &arena);
+		}
+	}
+
+	void test_chunk_directory_keeps_addresses()
+	{
+		// four elements per chunk, so the directory is reallocated many times while the elements stay put
+		my_adt::stable_vector<int, std::allocator<int>, std::allocator<int*>, my_adt::fixed_chunk_growth<4>> vec;
+		std::vector<const int*> addresses;
+		for (int i = 0; i < 10000; i++)
+		{
+			addresses.push_back(&vec.emplace_back(i));
+		}
+		assert(vec.chunk_count() == 2500 && vec.capacity() == 10000);
+		for (int i = 0; i < 10000; i++)
+		{
+			assert(&vec[i] == addresses[i] && vec[i] == i);
+		}
+
+		// iteration crosses every chunk boundary in both directions
+		int expected = 0;
+		for (int elem : vec)
+		{
+			assert(elem == expected++);
+		}
+		for (auto it = vec.end(); it != vec.begin();)
+		{
+			assert(*--it == --expected);
+		}
+		assert(expected == 0 && std::ranges::distance(vec.segments()) == 2500);
+
+		// moving the container hands over the directory, not the elements
+		auto moved = std::move(vec);
+		assert(&moved[0] == addresses[0] && &moved[9999] == addresses[9999] && vec.chunk_count() == 0);
+	}
+
+	// checks that the next push_back lands in the slot right after the last element, wherever the tail cursor was reset
+	void check_next_push(my_adt::stable_vector<int>& vec, const int* expected_slot)
+	{
+		std::size_t size = vec.size();
+		int& pushed = vec.emplace_back(static_cast<int>(size));
+		assert(vec.size() == size + 1 && vec[size] == static_cast<int>(size));
+		assert(expected_slot == nullptr || &pushed == expected_slot);
+	}
+
+	void test_push_back_tail_cursor()
+	{
+		// chunks of 1, 1, 2, 4, ...: every push up to 64 elements is checked, including the ones that end or start a chunk
+		my_adt::stable_vector<int> grown;
+		for (int i = 0; i < 64; i++)
+		{
+			check_next_push(grown, nullptr);
+			assert(grown.capacity() == std::bit_ceil(grown.size()));
+		}
+
+		// reserved chunks are filled in place, and the first push past them starts a new chunk
+		my_adt::stable_vector<int> reserved;
+		reserved.push_back(0);
+		reserved.reserve(100);
+		std::size_t chunks = reserved.chunk_count();
+		while (reserved.size() < 100)
+		{
+			check_next_push(reserved, nullptr);
+		}
+		assert(reserved.capacity() == 100 && reserved.chunk_count() == chunks);
+		check_next_push(reserved, nullptr);
+		assert(reserved.chunk_count() == chunks + 1);
+
+		// a cleared container that retains its chunks refills the same slots
+		my_adt::stable_vector<int> retained;
+		retained.retain_capacity();
+		std::vector<const int*> slots;
+		for (int i = 0; i < 100; i++)
+		{
+			slots.push_back(&retained.emplace_back(i));
+		}
+		retained.clear();
+		for (int i = 0; i < 100; i++)
+		{
+			check_next_push(retained, slots[i]);
+		}
+
+		// after truncating mid-chunk or onto a chunk boundary, pushes go to the first dropped slot
+		for (std::size_t kept : {37, 64})
+		{
+			retained.truncate(kept);
+			while (retained.size() < 100)
+			{
+				check_next_push(retained, slots[retained.size()]);
+			}
+		}
+		retained.truncate(0);
+		check_next_push(retained, slots[0]);
+		check_next_push(retained, slots[1]);
+	}
+
+	// throws from its constructor for one chosen value, to fail a push_back at a chosen index
+	struct throws_for
+	{
+		static inline int failing_value = -1;
+		int value;
+
+		explicit throws_for(int value) : value{value}
+		{
+			if (value == failing_value)
+			{
+				throw std::runtime_error("throws_for");
+			}
+		}
+	};
+
+	// throws std::bad_alloc once its shared budget of allocations is spent
+	template <typename T>
+	struct budget_allocator
+	{
+		using value_type = T;
+
+		int* budget;
+
+		explicit budget_allocator(int* budget) noexcept : budget{budget}  {}
+		template <typename U>
+		budget_allocator(const budget_allocator<U>& other) noexcept : budget{other.budget}  {}
+
+		T* allocate(std::size_t n)
+		{
+			if (*budget == 0)
+			{
+				throw std::bad_alloc{};
+			}
+			--*budget;
+			return std::allocator<T>{}.allocate(n);
+		}
+
+		void deallocate(T* ptr, std::size_t n) noexcept
+		{
+			std::allocator<T>{}.deallocate(ptr, n);
+		}
+
+		template <typename U>
+		friend bool operator==(const budget_allocator& a, const budget_allocator<U>& b) noexcept
+		{
+			return a.budget == b.budget;
+		}
+	};
+
+	void test_push_back_slow_path_exceptions()
+	{
+		// an element that throws in the last slot of a chunk, or as the first one of a new chunk, leaves the container as it was
+		my_adt::stable_vector<throws_for> vec;
+		for (int i = 0; i < 3; i++)
+		{
+			vec.emplace_back(i);
+		}
+		for (int failing : {3, 4})
+		{
+			throws_for::failing_value = failing;
+			bool threw = false;
+			try
+			{
+				vec.emplace_back(failing);
+			}
+			catch (const std::runtime_error&)
+			{
+				threw = true;
+			}
+			assert(threw && vec.size() == static_cast<std::size_t>(failing));
+			throws_for::failing_value = -1;
+			vec.emplace_back(failing);
+		}
+		vec.emplace_back(5);
+		int expected = 0;
+		for (const throws_for& elem : vec)
+		{
+			assert(elem.value == expected++);
+		}
+		assert(expected == 6);
+
+		// a failed chunk allocation leaves every element and the tail cursor in place
+		int budget = 3;
+		my_adt::stable_vector<int, budget_allocator<int>> limited{budget_allocator<int>{&budget}, std::allocator<int*>{}};
+		bool threw = false;
+		try
+		{
+			for (int i = 0; i < 100; i++)
+			{
+				limited.push_back(i);
+			}
+		}
+		catch (const std::bad_alloc&)
+		{
+			threw = true;
+		}
+		assert(threw && limited.size() == 4 && limited.capacity() == 4 && limited[3] == 3);
+		budget = 1;
+		limited.push_back(4);
+		assert(limited.size() == 5 && limited[4] == 4 && limited.capacity() == 8);
+	}
+}
+
 int main()
 {
 	my_adt::stable_vector<int> vec({1, 2, 3});
 	my_adt::stable_vector<int> vec2({1, 2, 3});
 	vec2 = vec;
-	std::copy(vec2.crbegin(), vec2.crend(), std::ostream_iterator<int>(std::cout, ", "));
-}
\ No newline at end of file
+	my_adt::copy(vec2.crbegin(), vec2.crend(), std::ostream_iterator<int>(std::cout, ", "));
+	std::cout << '\n';
+
+	test_iteration_over_adjacent_chunks();
+	test_swap_with_stateful_allocators();
+	test_small_vector_fills_inline_buffer_first();
+	test_hive_get_iterator();
+	test_hive_swap_and_assign_with_pmr();
+	test_slot_map_reuse_after_move();
+	test_nested_parallel_calls();
+	test_indexed_access();
+	test_random_access_iterators();
+	test_segments();
+	test_segment_algorithms();
+	test_simd_kernels();
+	test_parallel_algorithms();
+	test_reserve();
+	test_growth_policies();
+	test_retained_capacity();
+	test_aligned_allocator();
+	test_contiguous_stable_vector();
+	test_mapped_stable_vector();
+	test_pmr_arena();
+	test_memory_stats();
+	test_emplace_immovable();
+	test_bulk_appends();
+	test_overwrite_appends();
+	test_resize_and_truncate();
+	test_hive();
+	test_slot_map();
+	test_pmr_elements_use_the_arena();
+	test_pmr_appends_use_the_arena();
+	test_chunk_directory_keeps_addresses();
+	test_push_back_tail_cursor();
+	test_push_back_slow_path_exceptions();
+}
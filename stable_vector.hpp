@@ -1,14 +1,41 @@
 #pragma once
 
 #include <cassert>
+#include <bit>
+#include <compare>
 #include <exception>
+#include <functional>
 #include <initializer_list>
 #include <iterator>
+#include <limits>
 #include <memory>
-#include <list>
+#include <memory_resource>
+#include <numeric>
+#include <vector>
 #include <algorithm>
 #include <ranges>
+#include <span>
+#include <stdexcept>
 #include <type_traits>
+#include <utility>
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <new>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <system_error>
+
+#if defined(__linux__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
 
 
 
@@ -16,7 +43,7 @@
 
 namespace my_adt
 {
-	template <typename T, typename Allocator, typename ChunkAllocator>
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
 	class stable_vector;
 
 	template <typename T>
@@ -30,493 +57,734 @@ namespace my_adt
 	template <pointer_type T>
 	using add_const_to_pointer_t = add_const_to_pointer<T>::type;
 
-	namespace detail
-	{
-		template <typename T, typename Allocator = std::allocator<T>>
-		class vector_chunk
-		{
-			public:
-				class iterator;
-				class const_iterator;
-				class reverse_iterator;
-				class const_reverse_iterator;
-
-				template <typename U, typename SwapAllocator>
-				friend constexpr void swap(vector_chunk<U, SwapAllocator>::raw_iterator& a, vector_chunk<U, SwapAllocator>::raw_iterator& b) noexcept;
-
-				template <typename U, typename SwapAllocator>
-				friend constexpr void swap(vector_chunk<U, SwapAllocator>::iterator& a, vector_chunk<U, SwapAllocator>::iterator& b) noexcept;
-
-				template <typename U, typename SwapAllocator>
-				friend constexpr void swap(vector_chunk<U, SwapAllocator>::const_iterator& a, vector_chunk<U, SwapAllocator>::const_iterator& b) noexcept;
 
-				template <typename U, typename SwapAllocator>
-				friend constexpr void swap(vector_chunk<U, SwapAllocator>::reverse_iterator& a, vector_chunk<U, SwapAllocator>::reverse_iterator& b) noexcept;
 
-				template <typename U, typename SwapAllocator>
-				friend constexpr void swap(vector_chunk<U, SwapAllocator>::const_reverse_iterator& a, vector_chunk<U, SwapAllocator>::const_reverse_iterator& b) noexcept;
-			
-			private:
-				class raw_iterator;
 
-				struct capacity_tag {};
-				struct size_tag {};
-				struct vector_chunk_ptr_deleter
-				{
-					private:
-						Allocator& m_alloc_ref;
-						std::size_t m_size;
-						std::size_t m_capacity;
-
-					public:
-						constexpr vector_chunk_ptr_deleter(vector_chunk_ptr_deleter&& other) noexcept : m_alloc_ref(other.m_alloc_ref), m_size(other.m_size), m_capacity(other.m_capacity)  {}
-						vector_chunk_ptr_deleter& operator=(vector_chunk_ptr_deleter&& other)
-						{
-							m_alloc_ref = other.m_alloc_ref;
-							m_size = other.m_size;
-							m_capacity = other.m_capacity;
-
-							return *this;
-						}
-						constexpr vector_chunk_ptr_deleter(Allocator& alloc_ref, std::size_t size, std::size_t capacity) noexcept : m_alloc_ref{alloc_ref}, m_size{size}, m_capacity{capacity}  {}
-
-						constexpr void update_size(std::size_t size) noexcept
-						{
-							m_size = size;
-						}
-						constexpr void update_capacity(std::size_t capacity) noexcept
-						{
-							m_capacity = capacity;
-						}
-
-						constexpr void operator()(T* ptr) noexcept
-						{
-							if (m_capacity != 0)
-							{
-								for (std::size_t index = 0; index < m_size; index++)
-								{
-									std::allocator_traits<Allocator>::destroy(m_alloc_ref, ptr);
-								}
-								std::allocator_traits<Allocator>::deallocate(m_alloc_ref, ptr, m_capacity);
-							}
-						}
-				};
 
 
-				using chunk_deleter = vector_chunk_ptr_deleter;
-				using m_begin_pointer = std::unique_ptr<T[], chunk_deleter>;
 
 
-				Allocator m_allocator;
+	namespace detail
+	{
+		// the in-object buffer behind a stable_vector's first chunk; empty when InlineCapacity is 0
+		template <typename T, std::size_t N>
+		struct inline_chunk_storage
+		{
+			alignas(T) std::byte m_bytes[N * sizeof(T)];
 
-				m_begin_pointer m_begin;
-				std::size_t m_size;
-				std::size_t m_capacity;
+			T* data() noexcept
+			{
+				return reinterpret_cast<T*>(m_bytes);
+			}
 
-				constexpr void update_deleter_size() noexcept;
+			const T* data() const noexcept
+			{
+				return reinterpret_cast<const T*>(m_bytes);
+			}
+		};
 
-				constexpr void copy_initialize(const vector_chunk<T, Allocator>& other);
+		template <typename T>
+		struct inline_chunk_storage<T, 0>
+		{
+			constexpr T* data() noexcept
+			{
+				return nullptr;
+			}
 
-				constexpr raw_iterator raw_begin() noexcept;
-				constexpr raw_iterator raw_end() noexcept;
-				constexpr raw_iterator raw_cap_end() noexcept;
-				constexpr raw_iterator raw_before_end() noexcept;
-				constexpr raw_iterator raw_before_begin() noexcept;
+			constexpr const T* data() const noexcept
+			{
+				return nullptr;
+			}
+		};
 
+		// an allocator with its own construct, like polymorphic_allocator doing uses-allocator construction, has to build every
+		// element; the others leave elements to placement new, so bulk paths may use memcpy and the std::uninitialized_* algorithms
+		template <typename Allocator, typename T, typename... Args>
+		concept constructs_elements = requires(Allocator& allocator, T* p, Args&&... args)
+		{
+			allocator.construct(p, std::forward<Args>(args)...);
+		};
 
+		template <typename Allocator, typename T>
+		constexpr void destroy(Allocator& allocator, T* first, T* last) noexcept
+		{
+			for (; first != last; ++first)
+			{
+				std::allocator_traits<Allocator>::destroy(allocator, first);
+			}
+		}
 
-				class raw_iterator
+		// n value-initialized elements without args, n copies of the one arg otherwise
+		template <typename Allocator, typename T, typename... Args>
+		constexpr void uninitialized_construct_n(Allocator& allocator, T* dest, std::size_t n, const Args&... args)
+		{
+			if constexpr (!constructs_elements<Allocator, T, const Args&...> && sizeof...(Args) == 0)
+			{
+				std::uninitialized_value_construct_n(dest, n);
+			}
+			else if constexpr (!constructs_elements<Allocator, T, const Args&...> && sizeof...(Args) == 1)
+			{
+				std::uninitialized_fill_n(dest, n, args...);
+			}
+			else
+			{
+				T* current = dest;
+				try
 				{
-					public:
-						using iterator_category = std::bidirectional_iterator_tag;
-						using value_type = T;
-						using difference_type = long long;
-						using pointer = T*;
-						using reference = T&;
-
-					private:
-						pointer m_ptr;
-						
-					public:
-						constexpr raw_iterator() noexcept;
-						constexpr raw_iterator(pointer ptr) noexcept;
-
-						constexpr raw_iterator& operator++() noexcept;
-						constexpr raw_iterator operator++(int) noexcept;
-
-						constexpr raw_iterator& operator--() noexcept;
-						constexpr raw_iterator operator--(int) noexcept;
-
-						constexpr bool operator==(raw_iterator other) const noexcept;
-						constexpr bool operator==(iterator other) const noexcept;
-						constexpr bool operator==(const_iterator other) const noexcept;
-						constexpr bool operator==(reverse_iterator other) const noexcept;
-						constexpr bool operator==(const_reverse_iterator other) const noexcept;
-
-						constexpr reference operator*() noexcept;
-						constexpr pointer operator->() noexcept;
-
-						template <typename U, typename SwapAllocator>
-						friend constexpr void swap(vector_chunk<U, SwapAllocator>::raw_iterator& a, vector_chunk<U, SwapAllocator>::raw_iterator& b) noexcept;
-
-						friend class iterator;
-						friend class const_iterator;
-						friend class reverse_iterator;
-						friend class const_reverse_iterator;
-
-				};
-
-			public:
-				explicit constexpr vector_chunk();
-				explicit constexpr vector_chunk(const Allocator& allocator);
-				explicit constexpr vector_chunk(std::size_t n, size_tag, const Allocator& allocator = Allocator{});
-				explicit constexpr vector_chunk(std::size_t n, const T& val, size_tag, const Allocator& allocator = Allocator{});
-				explicit constexpr vector_chunk(std::size_t n, capacity_tag, const Allocator& allocator = Allocator{});
-				template <typename It>
-				explicit constexpr vector_chunk(It first, It last, const Allocator& allocator = Allocator{});
-				explicit constexpr vector_chunk(std::initializer_list<T> init_list, const Allocator& allocator = Allocator{});
-				template <typename Begin, typename Sent>
-				explicit constexpr vector_chunk(std::from_range_t, Begin first, Sent last, const Allocator& allocator = Allocator{});
-				template <typename Range>
-				explicit constexpr vector_chunk(std::from_range_t, Range&& range, const Allocator& allocator = Allocator{});
-
-				constexpr vector_chunk(const vector_chunk<T, Allocator>& other);
-				constexpr vector_chunk(const vector_chunk<T, Allocator>& other, const std::type_identity<Allocator>& allocator);
-				constexpr vector_chunk(vector_chunk<T, Allocator>&& other);
-				constexpr vector_chunk(vector_chunk<T, Allocator>&& other, const std::type_identity<Allocator>& allocator);
-
-				constexpr vector_chunk<T, Allocator>& operator=(vector_chunk<T, Allocator> other);
-				constexpr vector_chunk<T, Allocator>& operator=(std::initializer_list<T> init_list);
-
-				template <typename... Args>
-				constexpr bool emplace_back(Args&&... args);
-				constexpr bool push_back(const T& val);
-				constexpr bool push_back(T&& val);
-				constexpr bool pop_back();
-
-				constexpr bool resize(std::size_t n) noexcept;
-
-				constexpr void clear() noexcept;
-
-				constexpr bool empty() const noexcept;
-				constexpr bool full() const noexcept;
-				constexpr bool has_capacity() const noexcept;
-
-				constexpr iterator begin();
-				constexpr iterator end();
-				constexpr iterator cap_end();
-
-				constexpr const_iterator cbegin() const;
-				constexpr const_iterator cend() const;
-				constexpr const_iterator ccap_end() const;
-
-				constexpr reverse_iterator rbegin();
-				constexpr reverse_iterator rend();
-
-				constexpr const_reverse_iterator crbegin() const;
-				constexpr const_reverse_iterator crend() const;
-				
-				template <typename U, typename SwapAllocator>
-				friend constexpr void swap(vector_chunk<U, SwapAllocator>& a, vector_chunk<U, SwapAllocator>& b) noexcept;
-
-				template <typename U, typename SVAllocator, typename SVChunkAllocator>
-				friend class my_adt::stable_vector;
-
-
-
-				class iterator : private raw_iterator
+					for (; n > 0; --n, ++current)
+					{
+						std::allocator_traits<Allocator>::construct(allocator, current, args...);
+					}
+				}
+				catch (...)
 				{
-					public:
-						using iterator_category = std::bidirectional_iterator_tag;
-						using value_type = raw_iterator::value_type;
-						using difference_type = raw_iterator::difference_type;
-						using pointer = raw_iterator::pointer;
-						using reference = raw_iterator::reference;
-						
+					detail::destroy(allocator, dest, current);
+					throw;
+				}
+			}
+		}
 
-						constexpr iterator() noexcept;
-						constexpr iterator(raw_iterator it) noexcept;
-						constexpr iterator(pointer ptr) noexcept;
+		// default-initialization can't be asked of an allocator, so one that constructs elements value-initializes them
+		template <typename Allocator, typename T>
+		constexpr void uninitialized_default_construct_n(Allocator& allocator, T* dest, std::size_t n)
+		{
+			if constexpr (constructs_elements<Allocator, T>)
+			{
+				detail::uninitialized_construct_n(allocator, dest, n);
+			}
+			else
+			{
+				std::uninitialized_default_construct_n(dest, n);
+			}
+		}
 
-						constexpr iterator& operator++() noexcept;
-						constexpr iterator operator++(int) noexcept;
+		template <typename Allocator, typename It, typename T>
+		constexpr It uninitialized_copy_advance(Allocator& allocator, It first, std::size_t n, T* dest)
+		{
+			if constexpr (std::contiguous_iterator<It> && std::is_same_v<std::iter_value_t<It>, T> && std::is_trivially_copyable_v<T> &&
+						  !constructs_elements<Allocator, T, std::iter_reference_t<It>>)
+			{
+				if (!std::is_constant_evaluated() && n > 0)
+				{
+					std::memcpy(dest, std::to_address(first), n * sizeof(T));
+					return first + static_cast<std::iter_difference_t<It>>(n);
+				}
+			}
 
-						constexpr iterator& operator--() noexcept;
-						constexpr iterator operator--(int) noexcept;
+			T* current = dest;
+			try
+			{
+				for (; n > 0; --n, ++first, ++current)
+				{
+					std::allocator_traits<Allocator>::construct(allocator, current, *first);
+				}
+			}
+			catch (...)
+			{
+				detail::destroy(allocator, dest, current);
+				throw;
+			}
+			return first;
+		}
+	}
 
-						constexpr bool operator==(raw_iterator other) const noexcept;
-						constexpr bool operator==(iterator other) const noexcept;
-						constexpr bool operator==(const_iterator other) const noexcept;
-						constexpr bool operator==(reverse_iterator other) const noexcept;
-						constexpr bool operator==(const_reverse_iterator other) const noexcept;
+	namespace detail::simd
+	{
+		template <typename T>
+		concept element = std::is_arithmetic_v<T> && !std::is_same_v<T, bool>;
 
-						constexpr reference operator*() noexcept;
-						constexpr pointer operator->() noexcept;
+		// one 512-bit register of independent accumulators; keeping them apart lets the loops vectorize
+		// at every instruction set without reassociating floating point additions
+		template <typename T>
+		inline constexpr std::size_t lanes = sizeof(T) < 64 ? 64 / sizeof(T) : 1;
 
-						template <typename U, typename SVAllocator, typename SVChunkAllocator>
-						friend class my_adt::stable_vector;
+		// the kernels are plain loops, always inlined into the dispatch wrappers so each wrapper compiles them for its own target
+		struct sum_kernel
+		{
+			template <typename T>
+			[[gnu::always_inline]] static inline T run(const T* first, std::size_t n) noexcept
+			{
+				T acc[lanes<T>] = {};
+				std::size_t i = 0;
+				for (; i + lanes<T> <= n; i += lanes<T>)
+				{
+					for (std::size_t lane = 0; lane < lanes<T>; lane++)
+					{
+						acc[lane] += first[i + lane];
+					}
+				}
 
-						template <typename U, typename SwapAllocator>
-						friend constexpr void swap(vector_chunk<U, SwapAllocator>::iterator& a, vector_chunk<U, SwapAllocator>::iterator& b) noexcept;
+				T total{};
+				for (; i < n; i++)
+				{
+					total += first[i];
+				}
+				for (std::size_t lane = 0; lane < lanes<T>; lane++)
+				{
+					total += acc[lane];
+				}
+				return total;
+			}
+		};
 
-						friend class raw_iterator;
-						friend class const_iterator;
-						friend class reverse_iterator;
-						friend class const_reverse_iterator;
+		struct minmax_kernel
+		{
+			// n > 0
+			template <typename T>
+			[[gnu::always_inline]] static inline std::pair<T, T> run(const T* first, std::size_t n) noexcept
+			{
+				T low[lanes<T>];
+				T high[lanes<T>];
+				std::fill_n(low, lanes<T>, first[0]);
+				std::fill_n(high, lanes<T>, first[0]);
 
-				};
+				std::size_t i = 0;
+				for (; i + lanes<T> <= n; i += lanes<T>)
+				{
+					for (std::size_t lane = 0; lane < lanes<T>; lane++)
+					{
+						low[lane] = first[i + lane] < low[lane] ? first[i + lane] : low[lane];
+						high[lane] = high[lane] < first[i + lane] ? first[i + lane] : high[lane];
+					}
+				}
+				for (; i < n; i++)
+				{
+					low[0] = first[i] < low[0] ? first[i] : low[0];
+					high[0] = high[0] < first[i] ? first[i] : high[0];
+				}
 
-				class const_iterator : private raw_iterator
+				std::pair<T, T> result{low[0], high[0]};
+				for (std::size_t lane = 1; lane < lanes<T>; lane++)
 				{
-					public:
-						using iterator_category = std::bidirectional_iterator_tag;
-						using value_type = std::add_const_t<typename raw_iterator::value_type>;
-						using difference_type = raw_iterator::difference_type;
-						using pointer = add_const_to_pointer_t<typename raw_iterator::pointer>;
-						using reference = std::add_const_t<typename raw_iterator::reference>;
+					result.first = low[lane] < result.first ? low[lane] : result.first;
+					result.second = result.second < high[lane] ? high[lane] : result.second;
+				}
+				return result;
+			}
+		};
 
+		struct min_kernel
+		{
+			// n > 0
+			template <typename T>
+			[[gnu::always_inline]] static inline T run(const T* first, std::size_t n) noexcept
+			{
+				T low[lanes<T>];
+				std::fill_n(low, lanes<T>, first[0]);
 
-						constexpr const_iterator() noexcept;
-						constexpr const_iterator(raw_iterator it);
-						constexpr const_iterator(pointer ptr) noexcept;
+				std::size_t i = 0;
+				for (; i + lanes<T> <= n; i += lanes<T>)
+				{
+					for (std::size_t lane = 0; lane < lanes<T>; lane++)
+					{
+						low[lane] = first[i + lane] < low[lane] ? first[i + lane] : low[lane];
+					}
+				}
+				for (; i < n; i++)
+				{
+					low[0] = first[i] < low[0] ? first[i] : low[0];
+				}
 
-						constexpr const_iterator& operator++() noexcept;
-						constexpr const_iterator operator++(int) noexcept;
+				T result = low[0];
+				for (std::size_t lane = 1; lane < lanes<T>; lane++)
+				{
+					result = low[lane] < result ? low[lane] : result;
+				}
+				return result;
+			}
+		};
 
-						constexpr const_iterator& operator--() noexcept;
-						constexpr const_iterator operator--(int) noexcept;
+		struct max_kernel
+		{
+			// n > 0
+			template <typename T>
+			[[gnu::always_inline]] static inline T run(const T* first, std::size_t n) noexcept
+			{
+				T high[lanes<T>];
+				std::fill_n(high, lanes<T>, first[0]);
 
-						constexpr bool operator==(raw_iterator other) const noexcept;
-						constexpr bool operator==(iterator other) const noexcept;
-						constexpr bool operator==(const_iterator other) const noexcept;
-						constexpr bool operator==(reverse_iterator other) const noexcept;
-						constexpr bool operator==(const_reverse_iterator other) const noexcept;
+				std::size_t i = 0;
+				for (; i + lanes<T> <= n; i += lanes<T>)
+				{
+					for (std::size_t lane = 0; lane < lanes<T>; lane++)
+					{
+						high[lane] = high[lane] < first[i + lane] ? first[i + lane] : high[lane];
+					}
+				}
+				for (; i < n; i++)
+				{
+					high[0] = high[0] < first[i] ? first[i] : high[0];
+				}
 
-						constexpr reference operator*() noexcept;
-						constexpr pointer operator->() noexcept;
+				T result = high[0];
+				for (std::size_t lane = 1; lane < lanes<T>; lane++)
+				{
+					result = result < high[lane] ? high[lane] : result;
+				}
+				return result;
+			}
+		};
 
-						template <typename U, typename SVAllocator, typename SVChunkAllocator>
-						friend class my_adt::stable_vector;
+		struct count_kernel
+		{
+			template <typename T>
+			[[gnu::always_inline]] static inline std::size_t run(const T* first, std::size_t n, T value) noexcept
+			{
+				std::size_t acc[lanes<T>] = {};
+				std::size_t i = 0;
+				for (; i + lanes<T> <= n; i += lanes<T>)
+				{
+					for (std::size_t lane = 0; lane < lanes<T>; lane++)
+					{
+						acc[lane] += first[i + lane] == value;
+					}
+				}
 
-						template <typename U, typename SwapAllocator>
-						friend constexpr void swap(vector_chunk<U, SwapAllocator>::const_iterator& a, vector_chunk<U, SwapAllocator>::const_iterator& b) noexcept;
+				std::size_t total = 0;
+				for (; i < n; i++)
+				{
+					total += first[i] == value;
+				}
+				for (std::size_t lane = 0; lane < lanes<T>; lane++)
+				{
+					total += acc[lane];
+				}
+				return total;
+			}
+		};
 
-						friend class raw_iterator;
-						friend class iterator;
-						friend class reverse_iterator;
-						friend class const_reverse_iterator;
+		struct find_kernel
+		{
+			// offset of the first match, n if there is none
+			template <typename T>
+			[[gnu::always_inline]] static inline std::size_t run(const T* first, std::size_t n, T value) noexcept
+			{
+				// test whole blocks without branching, then pin down the match inside the first block that has one
+				std::size_t i = 0;
+				for (; i + lanes<T> <= n; i += lanes<T>)
+				{
+					bool hit = false;
+					for (std::size_t lane = 0; lane < lanes<T>; lane++)
+					{
+						hit |= first[i + lane] == value;
+					}
+					if (hit)
+					{
+						break;
+					}
+				}
+				for (; i < n; i++)
+				{
+					if (first[i] == value)
+					{
+						return i;
+					}
+				}
+				return n;
+			}
+		};
 
-				};
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+		// SSE2 is the x86-64 baseline, so the plain build of a kernel is the SSE2 (or scalar on 32-bit x86) path
+		enum class instruction_set { baseline, avx2, avx512 };
 
-				class reverse_iterator : private raw_iterator
+		inline instruction_set detected_instruction_set() noexcept
+		{
+			static const instruction_set detected = []
+			{
+				__builtin_cpu_init();
+				if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw") && __builtin_cpu_supports("avx512vl"))
 				{
-					public:
-						using iterator_category = std::bidirectional_iterator_tag;
-						using value_type = raw_iterator::value_type;
-						using difference_type = raw_iterator::difference_type;
-						using pointer = raw_iterator::pointer;
-						using reference = raw_iterator::reference;
+					return instruction_set::avx512;
+				}
+				if (__builtin_cpu_supports("avx2"))
+				{
+					return instruction_set::avx2;
+				}
+				return instruction_set::baseline;
+			}();
+			return detected;
+		}
 
+		template <typename Kernel, typename... Args>
+		[[gnu::target("avx512f,avx512bw,avx512vl,avx2")]] auto run_avx512(Args... args) noexcept
+		{
+			return Kernel::run(args...);
+		}
 
-						constexpr reverse_iterator() noexcept;
-						constexpr reverse_iterator(raw_iterator it);
-						constexpr reverse_iterator(pointer ptr) noexcept;
+		template <typename Kernel, typename... Args>
+		[[gnu::target("avx2")]] auto run_avx2(Args... args) noexcept
+		{
+			return Kernel::run(args...);
+		}
 
-						constexpr reverse_iterator& operator++() noexcept;
-						constexpr reverse_iterator operator++(int) noexcept;
+		template <typename Kernel, typename... Args>
+		auto dispatch(Args... args) noexcept
+		{
+			switch (detected_instruction_set())
+			{
+				case instruction_set::avx512:
+					return run_avx512<Kernel>(args...);
+				case instruction_set::avx2:
+					return run_avx2<Kernel>(args...);
+				default:
+					return Kernel::run(args...);
+			}
+		}
+#else
+		template <typename Kernel, typename... Args>
+		auto dispatch(Args... args) noexcept
+		{
+			return Kernel::run(args...);
+		}
+#endif
+	}
 
-						constexpr reverse_iterator& operator--() noexcept;
-						constexpr reverse_iterator operator--(int) noexcept;
+	// hands out buffers aligned to Alignment bytes; buffers of at least huge_page_size bytes are aligned and
+	// padded to whole huge pages and, on Linux, advised for transparent huge pages to cut TLB misses on scans
+	template <typename T, std::size_t Alignment = 64>
+	class aligned_allocator
+	{
+		static_assert(std::has_single_bit(Alignment), "the alignment must be a power of two");
 
-						constexpr bool operator==(raw_iterator other) const noexcept;
-						constexpr bool operator==(iterator other) const noexcept;
-						constexpr bool operator==(const_iterator other) const noexcept;
-						constexpr bool operator==(reverse_iterator other) const noexcept;
-						constexpr bool operator==(const_reverse_iterator other) const noexcept;
+		public:
+			using value_type = T;
+			using is_always_equal = std::true_type;
 
-						constexpr reference operator*() noexcept;
-						constexpr pointer operator->() noexcept;
+			static constexpr std::size_t alignment = std::max(Alignment, alignof(T));
+			static constexpr std::size_t huge_page_size = std::size_t{1} << 21;
 
-						template <typename U, typename SVAllocator, typename SVChunkAllocator>
-						friend class my_adt::stable_vector;
+			template <typename U>
+			struct rebind
+			{
+				using other = aligned_allocator<U, Alignment>;
+			};
 
-						template <typename U, typename SwapAllocator>
-						friend constexpr void swap(vector_chunk<U, SwapAllocator>::reverse_iterator& a, vector_chunk<U, SwapAllocator>::reverse_iterator& b) noexcept;
+			constexpr aligned_allocator() noexcept = default;
+			template <typename U>
+			constexpr aligned_allocator(const aligned_allocator<U, Alignment>&) noexcept  {}
 
-						friend class raw_iterator;
-						friend class iterator;
-						friend class const_iterator;
-						friend class const_reverse_iterator;
+			T* allocate(std::size_t n);
+			void deallocate(T* ptr, std::size_t n) noexcept;
 
-				};
+			template <typename U>
+			constexpr bool operator==(const aligned_allocator<U, Alignment>&) const noexcept
+			{
+				return true;
+			}
 
-				class const_reverse_iterator : private raw_iterator
-				{
-					public:
-						using iterator_category = std::bidirectional_iterator_tag;
-						using value_type = std::add_const_t<typename raw_iterator::value_type>;
-						using difference_type = raw_iterator::difference_type;
-						using pointer = add_const_to_pointer_t<typename raw_iterator::pointer>;
-						using reference = std::add_const_t<typename raw_iterator::reference>;
+		private:
+			static constexpr bool uses_huge_pages(std::size_t bytes) noexcept
+			{
+				return bytes >= huge_page_size;
+			}
+			static constexpr std::size_t allocation_size(std::size_t bytes) noexcept
+			{
+				return uses_huge_pages(bytes) ? (bytes + huge_page_size - 1) & ~(huge_page_size - 1) : bytes;
+			}
+			static constexpr std::align_val_t allocation_alignment(std::size_t bytes) noexcept
+			{
+				return std::align_val_t{uses_huge_pages(bytes) ? std::max(alignment, huge_page_size) : alignment};
+			}
+	};
 
+	template <typename T, std::size_t Alignment>
+	T* aligned_allocator<T, Alignment>::allocate(std::size_t n)
+	{
+		if (n > (std::numeric_limits<std::size_t>::max() - huge_page_size) / sizeof(T))
+		{
+			throw std::bad_array_new_length{};
+		}
 
-						constexpr const_reverse_iterator() noexcept;
-						constexpr const_reverse_iterator(raw_iterator it);
-						constexpr const_reverse_iterator(pointer ptr) noexcept;
+		std::size_t bytes = allocation_size(n * sizeof(T));
+		void* ptr = ::operator new(bytes, allocation_alignment(n * sizeof(T)));
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+		if (uses_huge_pages(bytes))
+		{
+			// advisory only: without THP support the buffer simply stays on regular pages
+			::madvise(ptr, bytes, MADV_HUGEPAGE);
+		}
+#endif
+		return static_cast<T*>(ptr);
+	}
 
-						constexpr const_reverse_iterator& operator++() noexcept;
-						constexpr const_reverse_iterator operator++(int) noexcept;
+	template <typename T, std::size_t Alignment>
+	void aligned_allocator<T, Alignment>::deallocate(T* ptr, std::size_t n) noexcept
+	{
+		::operator delete(ptr, allocation_size(n * sizeof(T)), allocation_alignment(n * sizeof(T)));
+	}
 
-						constexpr const_reverse_iterator& operator--() noexcept;
-						constexpr const_reverse_iterator operator--(int) noexcept;
+	// a growth policy sizes each new chunk from the current capacity and the element size; it may also
+	// offer chunk_index_of, an O(1) guess of the chunk holding an index when every chunk was sized by the
+	// policy. guesses are checked against the chunk ends, so reserve() never breaks a lookup
+	template <typename Policy>
+	concept growth_policy = requires(std::size_t n)
+	{
+		{ Policy::next_chunk_capacity(n, n) } -> std::convertible_to<std::size_t>;
+	};
 
-						constexpr bool operator==(raw_iterator other) const noexcept;
-						constexpr bool operator==(iterator other) const noexcept;
-						constexpr bool operator==(const_iterator other) const noexcept;
-						constexpr bool operator==(reverse_iterator other) const noexcept;
-						constexpr bool operator==(const_reverse_iterator other) const noexcept;
+	template <typename Policy>
+	concept indexed_growth_policy = growth_policy<Policy> && requires(std::size_t n)
+	{
+		{ Policy::chunk_index_of(n, n) } -> std::convertible_to<std::size_t>;
+	};
 
-						constexpr reference operator*() noexcept;
-						constexpr pointer operator->() noexcept;
+	// every chunk grows the capacity by a factor of Numerator / Denominator, starting from a single element
+	template <std::size_t Numerator = 2, std::size_t Denominator = 1>
+	struct geometric_growth
+	{
+		static_assert(Denominator != 0 && Numerator > Denominator, "the growth factor must be greater than 1");
 
-						template <typename U, typename SVAllocator, typename SVChunkAllocator>
-						friend class my_adt::stable_vector;
+		static constexpr std::size_t next_chunk_capacity(std::size_t capacity, std::size_t) noexcept
+		{
+			return std::max<std::size_t>(capacity * (Numerator - Denominator) / Denominator, 1);
+		}
 
-						template <typename U, typename SwapAllocator>
-						friend constexpr void swap(vector_chunk<U, SwapAllocator>::const_reverse_iterator& a, vector_chunk<U, SwapAllocator>::const_reverse_iterator& b) noexcept;
+		// chunks hold 1, 1, 2, 4, ... elements, so chunk k starts at 2^(k - 1)
+		static constexpr std::size_t chunk_index_of(std::size_t index, std::size_t) noexcept
+			requires (Numerator == 2 * Denominator)
+		{
+			return std::bit_width(index);
+		}
+	};
 
-						friend class raw_iterator;
-						friend class iterator;
-						friend class const_iterator;
-						friend class reverse_iterator;
+	// every chunk holds ChunkSize elements, like the blocks of a deque
+	template <std::size_t ChunkSize>
+	struct fixed_chunk_growth
+	{
+		static_assert(ChunkSize != 0, "chunks must hold at least one element");
 
-				};
-		};
-	}
+		static constexpr std::size_t next_chunk_capacity(std::size_t, std::size_t) noexcept
+		{
+			return ChunkSize;
+		}
 
+		static constexpr std::size_t chunk_index_of(std::size_t index, std::size_t) noexcept
+		{
+			return index / ChunkSize;
+		}
+	};
 
+	// grows geometrically until a chunk would exceed MaxChunkBytes, then keeps allocating chunks of that size
+	template <std::size_t MaxChunkBytes, std::size_t Numerator = 2, std::size_t Denominator = 1>
+	struct capped_geometric_growth
+	{
+		static constexpr std::size_t max_chunk_capacity(std::size_t element_size) noexcept
+		{
+			return std::max<std::size_t>(MaxChunkBytes / element_size, 1);
+		}
 
+		static constexpr std::size_t next_chunk_capacity(std::size_t capacity, std::size_t element_size) noexcept
+		{
+			return std::min(geometric_growth<Numerator, Denominator>::next_chunk_capacity(capacity, element_size), max_chunk_capacity(element_size));
+		}
 
+		// doubling stops once the capacity passes the cap, at twice its largest power of two
+		static constexpr std::size_t chunk_index_of(std::size_t index, std::size_t element_size) noexcept
+			requires (Numerator == 2 * Denominator)
+		{
+			std::size_t max_capacity = max_chunk_capacity(element_size);
+			std::size_t capped_start = std::bit_floor(max_capacity) * 2;
+			if (index < capped_start)
+			{
+				return std::bit_width(index);
+			}
+			return std::bit_width(max_capacity) + 1 + (index - capped_start) / max_capacity;
+		}
+	};
 
+	// one chunk of a stable_vector as reported by memory_stats(); an inline chunk lives inside the container object
+	struct stable_vector_chunk_stats
+	{
+		std::size_t first_index;
+		std::size_t capacity;
+		std::size_t size;
+		bool is_inline;
+	};
 
+	// byte counts cover memory obtained from the allocators, not the container object itself: bytes_allocated is element
+	// storage, bytes_metadata the chunk directory and end table, and bytes_slack the allocated element storage holding no element
+	struct stable_vector_memory_stats
+	{
+		std::size_t size;
+		std::size_t capacity;
+		std::size_t chunk_count;
+		std::size_t bytes_allocated;
+		std::size_t bytes_metadata;
+		std::size_t bytes_slack;
+		std::vector<stable_vector_chunk_stats> chunks;
+	};
 
-	template <typename T, typename Allocator = std::allocator<T>, typename ChunkAllocator = std::allocator<detail::vector_chunk<T, Allocator>>>
+	template <typename T, typename Allocator = std::allocator<T>, typename ChunkAllocator = std::allocator<T*>, typename GrowthPolicy = geometric_growth<>, std::size_t InlineCapacity = 0>
 	class stable_vector
 	{
+		static_assert(growth_policy<GrowthPolicy>, "GrowthPolicy must provide next_chunk_capacity(capacity, element_size)");
+
 		public:
+			using allocator_type = Allocator;
+
 			class iterator;
 			class const_iterator;
 			class reverse_iterator;
 			class const_reverse_iterator;
 
-			template <typename U, typename SwapAllocator, typename SwapChunkAllocator>
-			friend constexpr void swap(stable_vector<U, SwapAllocator, SwapChunkAllocator>::raw_iterator& a, stable_vector<U, SwapAllocator, SwapChunkAllocator>::raw_iterator& b) noexcept;
+			template <typename U, typename SwapAllocator, typename SwapChunkAllocator, typename SwapGrowthPolicy, std::size_t SwapInlineCapacity>
+			friend constexpr void swap(stable_vector<U, SwapAllocator, SwapChunkAllocator, SwapGrowthPolicy, SwapInlineCapacity>::raw_iterator& a, stable_vector<U, SwapAllocator, SwapChunkAllocator, SwapGrowthPolicy, SwapInlineCapacity>::raw_iterator& b) noexcept;
 			
-			template <typename U, typename SwapAllocator, typename SwapChunkAllocator>
-			friend constexpr void swap(stable_vector<U, SwapAllocator, SwapChunkAllocator>::iterator& a, stable_vector<U, SwapAllocator, SwapChunkAllocator>::iterator& b) noexcept;
+			template <typename U, typename SwapAllocator, typename SwapChunkAllocator, typename SwapGrowthPolicy, std::size_t SwapInlineCapacity>
+			friend constexpr void swap(stable_vector<U, SwapAllocator, SwapChunkAllocator, SwapGrowthPolicy, SwapInlineCapacity>::iterator& a, stable_vector<U, SwapAllocator, SwapChunkAllocator, SwapGrowthPolicy, SwapInlineCapacity>::iterator& b) noexcept;
 
-			template <typename U, typename SwapAllocator, typename SwapChunkAllocator>
-			friend constexpr void swap(stable_vector<U, SwapAllocator, SwapChunkAllocator>::const_iterator& a, stable_vector<U, SwapAllocator, SwapChunkAllocator>::const_iterator& b) noexcept;
+			template <typename U, typename SwapAllocator, typename SwapChunkAllocator, typename SwapGrowthPolicy, std::size_t SwapInlineCapacity>
+			friend constexpr void swap(stable_vector<U, SwapAllocator, SwapChunkAllocator, SwapGrowthPolicy, SwapInlineCapacity>::const_iterator& a, stable_vector<U, SwapAllocator, SwapChunkAllocator, SwapGrowthPolicy, SwapInlineCapacity>::const_iterator& b) noexcept;
 
-			template <typename U, typename SwapAllocator, typename SwapChunkAllocator>
-			friend constexpr void swap(stable_vector<U, SwapAllocator, SwapChunkAllocator>::reverse_iterator& a, stable_vector<U, SwapAllocator, SwapChunkAllocator>::reverse_iterator& b) noexcept;
+			template <typename U, typename SwapAllocator, typename SwapChunkAllocator, typename SwapGrowthPolicy, std::size_t SwapInlineCapacity>
+			friend constexpr void swap(stable_vector<U, SwapAllocator, SwapChunkAllocator, SwapGrowthPolicy, SwapInlineCapacity>::reverse_iterator& a, stable_vector<U, SwapAllocator, SwapChunkAllocator, SwapGrowthPolicy, SwapInlineCapacity>::reverse_iterator& b) noexcept;
 
-			template <typename U, typename SwapAllocator, typename SwapChunkAllocator>
-			friend constexpr void swap(stable_vector<U, SwapAllocator, SwapChunkAllocator>::const_reverse_iterator& a, stable_vector<U, SwapAllocator, SwapChunkAllocator>::const_reverse_iterator& b) noexcept;
+			template <typename U, typename SwapAllocator, typename SwapChunkAllocator, typename SwapGrowthPolicy, std::size_t SwapInlineCapacity>
+			friend constexpr void swap(stable_vector<U, SwapAllocator, SwapChunkAllocator, SwapGrowthPolicy, SwapInlineCapacity>::const_reverse_iterator& a, stable_vector<U, SwapAllocator, SwapChunkAllocator, SwapGrowthPolicy, SwapInlineCapacity>::const_reverse_iterator& b) noexcept;
 
 		private:
 			class raw_iterator;
 			struct uninit_tag {};
 
-			using chunk = detail::vector_chunk<T, Allocator>;
-			using list = std::list<chunk, ChunkAllocator>;
-			using list_iterator = list::iterator;
+			// chunk k is only its buffer; its capacity comes from m_chunk_ends and its size from m_size, keeping the per-chunk
+			// bookkeeping at two words. ChunkAllocator, rebound as needed, allocates this directory and the end table
+			using chunk_directory = std::vector<T*, typename std::allocator_traits<ChunkAllocator>::template rebind_alloc<T*>>;
+
 
+			using chunk_end_table = std::vector<std::size_t, typename std::allocator_traits<ChunkAllocator>::template rebind_alloc<std::size_t>>;
 
-			const Allocator m_allocator;
-			list m_chunks;
+
+			Allocator m_allocator;
+			chunk_directory m_chunks;
+			// m_chunk_ends[k] is one past the last index chunk k can hold, i.e. where chunk k + 1 starts
+			chunk_end_table m_chunk_ends;
 			std::size_t m_size;
 			std::size_t m_capacity;
-			iterator m_end;
+			// the chunk holding index m_size, where the next element goes; m_chunks.size() when full
+			std::size_t m_tail_chunk;
+			// where the next element goes and the last slot of the tail chunk; both null when full, so while they differ
+			// emplace_back only constructs and bumps. filling the last slot of a chunk takes the slow path, which keeps
+			// m_tail_chunk in step
+			T* m_tail_next;
+			T* m_tail_last;
+			// clear() keeps the leading chunks whose capacity fits under this many elements; 0 frees them all
+			std::size_t m_retained_limit;
+			// backs the first chunk when it holds at most InlineCapacity elements, so small containers never allocate element storage
+			[[no_unique_address]] detail::inline_chunk_storage<T, InlineCapacity> m_inline;
 
 			explicit constexpr stable_vector(uninit_tag);
 			explicit constexpr stable_vector(uninit_tag, const Allocator& allocator);
 			explicit constexpr stable_vector(uninit_tag, const Allocator& allocator, const ChunkAllocator& chunk_allocator);
 
-			constexpr void init_empty_chunks();
+			constexpr void copy_initialize(const stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>& other);
+			constexpr void move_initialize(stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>& other);
+			template <bool Move>
+			constexpr void append_from(const stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>& other);
 
-			constexpr void copy_initialize(const stable_vector<T, Allocator, ChunkAllocator>& other);
+			// the chunk directory shares the element allocator's memory source unless given an allocator of its own
+			static constexpr ChunkAllocator chunk_allocator_for(const Allocator& allocator);
 
-			constexpr bool chunks_full() const noexcept;
-			constexpr bool current_chunk_empty() const noexcept;
-			constexpr bool current_chunk_full() const noexcept;
-			constexpr bool end_at_chunk_start() const noexcept;
-			constexpr bool current_chunk_has_capacity() const noexcept;
+			template <typename Fill>
+			constexpr void append_chunks(std::size_t n, Fill fill);
+			template <typename Fill>
+			constexpr void append_filled(std::size_t n, Fill fill);
 
 			constexpr void push_chunk(std::size_t size);
-			constexpr void push_empty_chunk();
+			constexpr void truncate_chunks(std::size_t chunk_count);
+			// destroys the elements from index first on and makes first the new size
+			constexpr void destroy_elements(std::size_t first = 0) noexcept;
+			constexpr void reset_tail_cursor() noexcept;
+			template <typename... Args>
+			constexpr T& emplace_back_slow(Args&&... args);
+			constexpr void take_inline_chunk(stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>& other);
+			constexpr void relocate_first_chunk(T* buffer);
+			constexpr std::size_t next_chunk_capacity() const noexcept;
 
 			constexpr bool has_capacity() const noexcept;
-			constexpr bool one_away_from_full() const noexcept;
+			constexpr bool full() const noexcept;
+
+			constexpr std::size_t segment_count() const noexcept;
+			std::size_t find_index(T value) const requires detail::simd::element<T>;
+
+			// chunks grown one at a time hold 1, 1, 2, 4, ... elements, so chunk k starts at index 2^(k-1) and the bit width of
+			// an index names its chunk; reserve() breaks that pattern, and lookups fall back to a binary search over m_chunk_ends
+			constexpr std::size_t chunk_index_of(std::size_t index) const noexcept;
+			constexpr std::size_t chunk_start_of(std::size_t chunk_index) const noexcept;
+			constexpr std::size_t chunk_end_of(std::size_t chunk_index) const noexcept;
+			constexpr std::span<T> chunk_span(std::size_t chunk_index) const noexcept;
+			constexpr std::size_t inline_chunk_capacity() const noexcept;
 
-			constexpr raw_iterator raw_begin() noexcept;
-			constexpr raw_iterator raw_end() noexcept;
-			constexpr raw_iterator raw_before_end() noexcept;
-			constexpr raw_iterator raw_before_begin() noexcept;
+			constexpr raw_iterator raw_begin() const noexcept;
+			constexpr raw_iterator raw_end() const noexcept;
+			constexpr raw_iterator raw_before_end() const noexcept;
+			constexpr raw_iterator raw_before_begin() const noexcept;
 
 
 
 			class raw_iterator
 			{
 				public:
-					using iterator_category = std::bidirectional_iterator_tag;
+					using iterator_category = std::random_access_iterator_tag;
+					using iterator_concept = std::random_access_iterator_tag;
 					using value_type = T;
 					using difference_type = long long;
 					using pointer = T*;
 					using reference = T&;
 
 				private:
-					using list_iterator_type = list_iterator;
-					using chunk_iterator_type = chunk::iterator;
+					const stable_vector* m_vector;
+					std::size_t m_chunk_index;
+					pointer m_ptr;
+					// first and last slot of the current chunk, so stepping is a pointer compare and only leaves the chunk at its boundary
+					pointer m_chunk_begin;
+					pointer m_chunk_last;
 
+					static constexpr std::size_t before_begin_chunk = static_cast<std::size_t>(-1);
 
-					list_iterator_type m_list_iterator;
-					chunk_iterator_type m_chunk_iterator;
 
+					constexpr std::size_t index() const noexcept;
 
-					constexpr bool at_chunk_start() const noexcept;
-					
-					constexpr void go_to_previous_chunk_end() noexcept;
+					constexpr void enter_chunk(std::size_t chunk_index) noexcept;
+					constexpr void locate(std::size_t index) noexcept;
 
 					constexpr void increment() noexcept;
 					constexpr void decrement() noexcept;
 
-					constexpr list_iterator_type& get_list_iterator() noexcept;
-					constexpr chunk_iterator_type& get_chunk_iterator() noexcept;
-					
 				public:
 					constexpr raw_iterator() noexcept;
-					constexpr raw_iterator(list_iterator_type list_iterator, chunk_iterator_type ptr) noexcept;
+					constexpr raw_iterator(const stable_vector* vector, std::size_t index) noexcept;
 					
+					// call fn(segment_first, segment_last) on each contiguous piece of [*this, last), stopping early when fn returns false
+					template <typename Pointer, typename Fn>
+					constexpr bool walk_segments(raw_iterator last, Fn& fn) const;
+					template <typename Pointer, typename Fn>
+					constexpr bool walk_segments_reverse(raw_iterator last, Fn& fn) const;
+
 					constexpr raw_iterator& operator++() noexcept;
 					constexpr raw_iterator operator++(int) noexcept;
 
 					constexpr raw_iterator& operator--() noexcept;
 					constexpr raw_iterator operator--(int) noexcept;
 
+					constexpr raw_iterator& operator+=(difference_type n) noexcept;
+					constexpr raw_iterator& operator-=(difference_type n) noexcept;
+					constexpr difference_type operator-(raw_iterator other) const noexcept;
+
 					constexpr bool operator==(raw_iterator other) const noexcept;
 					constexpr bool operator==(iterator other) const noexcept;
 					constexpr bool operator==(const_iterator other) const noexcept;
 					constexpr bool operator==(reverse_iterator other) const noexcept;
 					constexpr bool operator==(const_reverse_iterator other) const noexcept;
+					constexpr std::strong_ordering operator<=>(raw_iterator other) const noexcept;
 
-					constexpr reference operator*() noexcept;
-					constexpr pointer operator->() noexcept;
+					constexpr reference operator*() const noexcept;
+					constexpr pointer operator->() const noexcept;
 
-					friend class stable_vector<T, Allocator, ChunkAllocator>;
+					friend class stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>;
 
-					template <typename U, typename SwapAllocator, typename SwapChunkAllocator>
-					friend constexpr void swap(stable_vector<U, SwapAllocator, SwapChunkAllocator>::raw_iterator& a, stable_vector<U, SwapAllocator, SwapChunkAllocator>::raw_iterator& b) noexcept;
+					template <typename U, typename SwapAllocator, typename SwapChunkAllocator, typename SwapGrowthPolicy, std::size_t SwapInlineCapacity>
+					friend constexpr void swap(stable_vector<U, SwapAllocator, SwapChunkAllocator, SwapGrowthPolicy, SwapInlineCapacity>::raw_iterator& a, stable_vector<U, SwapAllocator, SwapChunkAllocator, SwapGrowthPolicy, SwapInlineCapacity>::raw_iterator& b) noexcept;
 
 					friend class iterator;
 					friend class const_iterator;
@@ -538,15 +806,19 @@ namespace my_adt
 			template <typename Range>
 			explicit constexpr stable_vector(std::from_range_t, Range&& range, const Allocator& allocator = Allocator{}, const ChunkAllocator& chunk_allocator = ChunkAllocator{});
 
-			constexpr stable_vector(const stable_vector<T, Allocator, ChunkAllocator>& other);
-			constexpr stable_vector(const stable_vector<T, Allocator, ChunkAllocator>& other, const std::type_identity<Allocator>& allocator);
-			constexpr stable_vector(const stable_vector<T, Allocator, ChunkAllocator>& other, const std::type_identity<Allocator>& allocator, const std::type_identity<ChunkAllocator>& chunk_allocator);
-			constexpr stable_vector(stable_vector<T, Allocator, ChunkAllocator>&& other);
-			constexpr stable_vector(stable_vector<T, Allocator, ChunkAllocator>&& other, const std::type_identity<Allocator>& allocator);
-			constexpr stable_vector(stable_vector<T, Allocator, ChunkAllocator>&& other, const std::type_identity<Allocator>& allocator, const std::type_identity<ChunkAllocator>& chunk_allocator);
+			constexpr stable_vector(const stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>& other);
+			constexpr stable_vector(const stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>& other, const std::type_identity_t<Allocator>& allocator);
+			constexpr stable_vector(const stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>& other, const std::type_identity_t<Allocator>& allocator, const std::type_identity_t<ChunkAllocator>& chunk_allocator);
+			constexpr stable_vector(stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>&& other);
+			constexpr stable_vector(stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>&& other, const std::type_identity_t<Allocator>& allocator);
+			constexpr stable_vector(stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>&& other, const std::type_identity_t<Allocator>& allocator, const std::type_identity_t<ChunkAllocator>& chunk_allocator);
+
+			constexpr ~stable_vector();
 
-			constexpr stable_vector<T, Allocator, ChunkAllocator>& operator=(stable_vector<T, Allocator, ChunkAllocator> other);
-			constexpr stable_vector<T, Allocator, ChunkAllocator>& operator=(std::initializer_list<T> init_list);
+			constexpr stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>& operator=(stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity> other);
+			constexpr stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>& operator=(std::initializer_list<T> init_list);
+
+			constexpr Allocator get_allocator() const noexcept;
 
 			void assign(std::size_t n, const T& val);
 			template <typename It>
@@ -557,18 +829,65 @@ namespace my_adt
 			void assign_range(Range&& range);
 			
 
+			// elements are constructed in place and never relocated, so T need not be copyable or movable; only moving
+			// or swapping a container with an inline chunk, and allocator-mismatched move assignment, move elements
 			template <typename... Args>
-			constexpr void emplace_back(Args&&... args);
+			constexpr T& emplace_back(Args&&... args);
 			constexpr void push_back(const T& other);
 			constexpr void push_back(T&& other);
 			constexpr void pop_back();
 
+			// bulk appends of a known length fill the free tail of the current chunk and put the rest into one new chunk;
+			// input ranges of unknown length fall back to emplace_back
+			template <typename Range>
+			constexpr void append_range(Range&& range);
+			template <typename It>
+			constexpr void append(It first, It last);
+			constexpr void append_n(std::size_t n, const T& value);
+
+			// appends default-initialized elements for the caller to overwrite, e.g. straight from read() or a decompressor.
+			// grow_for_overwrite(n) stays within one chunk and returns the new elements, which may be fewer than n when the
+			// tail chunk runs out; append_uninitialized(n, fn) appends exactly n and passes fn one span per chunk touched
+			constexpr std::span<T> grow_for_overwrite(std::size_t n) requires std::is_trivially_default_constructible_v<T>;
+			template <typename Fn>
+			constexpr void append_uninitialized(std::size_t n, Fn fn) requires std::is_trivially_default_constructible_v<T>;
+
 			constexpr T& front();
 			constexpr T& back();
 
+			constexpr T& operator[](std::size_t index) noexcept;
+			constexpr const T& operator[](std::size_t index) const noexcept;
+			constexpr T& at(std::size_t index);
+			constexpr const T& at(std::size_t index) const;
+			constexpr T* data_at(std::size_t index) noexcept;
+			constexpr const T* data_at(std::size_t index) const noexcept;
+
+			// reserve(n) makes room for n elements in total and reserve_extra(n) for n beyond size(), each with at most one allocation
+			constexpr void reserve(std::size_t n);
 			constexpr void reserve_extra(std::size_t n);
+			constexpr std::size_t capacity() const noexcept;
 			constexpr void clear();
 
+			// growing appends the new elements in bulk, filling the tail chunk and then one new chunk; shrinking destroys
+			// the dropped elements and frees the trailing chunks no longer needed, except those kept by retain_capacity()
+			constexpr void resize(std::size_t n);
+			constexpr void resize(std::size_t n, const T& value);
+			constexpr void resize_for_overwrite(std::size_t n) requires std::is_trivially_default_constructible_v<T>;
+			constexpr void truncate(std::size_t n);
+
+			// retained-capacity mode for containers that are filled and cleared over and over: clear() keeps the
+			// leading chunks holding up to limit elements, so refilling reuses their buffers in place. trailing
+			// pop_back()s always keep emptied chunks, and release_unused() frees every chunk past the last element
+			constexpr void retain_capacity(std::size_t limit = std::numeric_limits<std::size_t>::max()) noexcept;
+			constexpr std::size_t retained_capacity_limit() const noexcept;
+			constexpr void release_unused();
+
+			constexpr std::size_t chunk_count() const noexcept;
+			constexpr std::size_t bytes_allocated() const noexcept;
+			constexpr std::size_t bytes_metadata() const noexcept;
+			constexpr std::size_t bytes_slack() const noexcept;
+			constexpr stable_vector_memory_stats memory_stats() const;
+
 			constexpr bool empty() const noexcept;
 
 			constexpr std::size_t size() const noexcept;
@@ -585,23 +904,42 @@ namespace my_adt
 			constexpr const_reverse_iterator crbegin() const noexcept;
 			constexpr const_reverse_iterator crend() const noexcept;
 
+			// one contiguous span per non-empty chunk, in element order
+			constexpr auto segments() noexcept;
+			constexpr auto segments() const noexcept;
+
+			template <typename Fn>
+			constexpr void for_each_segment(Fn fn);
+			template <typename Fn>
+			constexpr void for_each_segment(Fn fn) const;
+
+			// vectorized scans over each chunk's buffer for arithmetic element types, using the widest instruction set
+			// the CPU supports; min(), max() and minmax() require a non-empty container, and NaNs leave their result unspecified
+			T sum() const requires detail::simd::element<T>;
+			T min() const requires detail::simd::element<T>;
+			T max() const requires detail::simd::element<T>;
+			std::pair<T, T> minmax() const requires detail::simd::element<T>;
+			std::size_t count(T value) const requires detail::simd::element<T>;
+			iterator find(T value) requires detail::simd::element<T>;
+			const_iterator find(T value) const requires detail::simd::element<T>;
+
 
-			template <typename U, typename SwapAllocator, typename SwapChunkAllocator>
-			friend constexpr void swap(stable_vector<U, SwapAllocator, SwapChunkAllocator>& a, stable_vector<U, SwapAllocator, SwapChunkAllocator>& b) noexcept;
+			template <typename U, typename SwapAllocator, typename SwapChunkAllocator, typename SwapGrowthPolicy, std::size_t SwapInlineCapacity>
+			friend constexpr void swap(stable_vector<U, SwapAllocator, SwapChunkAllocator, SwapGrowthPolicy, SwapInlineCapacity>& a, stable_vector<U, SwapAllocator, SwapChunkAllocator, SwapGrowthPolicy, SwapInlineCapacity>& b) noexcept;
 
 
 			class iterator : private raw_iterator
 			{						
 				public:
-					using iterator_category = std::bidirectional_iterator_tag;
+					using iterator_category = std::random_access_iterator_tag;
+					using iterator_concept = std::random_access_iterator_tag;
 					using value_type = raw_iterator::value_type;
 					using difference_type = raw_iterator::difference_type;
 					using pointer = raw_iterator::pointer;
 					using reference = raw_iterator::reference;
 
 					constexpr iterator() noexcept;
-					constexpr iterator(raw_iterator it);
-					constexpr iterator(raw_iterator::list_iterator_type list_iterator, raw_iterator::chunk_iterator_type ptr) noexcept;
+					constexpr iterator(raw_iterator it) noexcept;
 
 					constexpr iterator& operator++() noexcept;
 					constexpr iterator operator++(int) noexcept;
@@ -609,19 +947,31 @@ namespace my_adt
 					constexpr iterator& operator--() noexcept;
 					constexpr iterator operator--(int) noexcept;
 
-					constexpr bool operator==(raw_iterator other) const noexcept;
+					constexpr iterator& operator+=(difference_type n) noexcept;
+					constexpr iterator& operator-=(difference_type n) noexcept;
+					constexpr iterator operator+(difference_type n) const noexcept;
+					constexpr iterator operator-(difference_type n) const noexcept;
+					constexpr difference_type operator-(iterator other) const noexcept;
+
+					friend constexpr iterator operator+(difference_type n, iterator it) noexcept  { return it + n; }
+
+					template <typename Fn>
+					friend constexpr bool for_each_segment(iterator first, iterator last, Fn&& fn)  { return first.template walk_segments<T*>(last, fn); }
+
 					constexpr bool operator==(iterator other) const noexcept;
 					constexpr bool operator==(const_iterator other) const noexcept;
 					constexpr bool operator==(reverse_iterator other) const noexcept;
 					constexpr bool operator==(const_reverse_iterator other) const noexcept;
+					constexpr std::strong_ordering operator<=>(iterator other) const noexcept;
 
-					constexpr reference operator*() noexcept;
-					constexpr pointer operator->() noexcept;
+					constexpr reference operator*() const noexcept;
+					constexpr pointer operator->() const noexcept;
+					constexpr reference operator[](difference_type n) const noexcept;
 
-					friend class stable_vector<T, Allocator, ChunkAllocator>;
+					friend class stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>;
 
-					template <typename U, typename SwapAllocator, typename SwapChunkAllocator>
-					friend constexpr void swap(stable_vector<U, SwapAllocator, SwapChunkAllocator>::iterator& a, stable_vector<U, SwapAllocator, SwapChunkAllocator>::iterator& b) noexcept;
+					template <typename U, typename SwapAllocator, typename SwapChunkAllocator, typename SwapGrowthPolicy, std::size_t SwapInlineCapacity>
+					friend constexpr void swap(stable_vector<U, SwapAllocator, SwapChunkAllocator, SwapGrowthPolicy, SwapInlineCapacity>::iterator& a, stable_vector<U, SwapAllocator, SwapChunkAllocator, SwapGrowthPolicy, SwapInlineCapacity>::iterator& b) noexcept;
 
 					friend class raw_iterator;
 					friend class const_iterator;
@@ -632,15 +982,15 @@ namespace my_adt
 			class const_iterator : private raw_iterator
 			{						
 				public:
-					using iterator_category = std::bidirectional_iterator_tag;
+					using iterator_category = std::random_access_iterator_tag;
+					using iterator_concept = std::random_access_iterator_tag;
 					using value_type = std::add_const_t<typename raw_iterator::value_type>;
 					using difference_type = raw_iterator::difference_type;
 					using pointer = add_const_to_pointer_t<typename raw_iterator::pointer>;
-					using reference = std::add_const_t<typename raw_iterator::reference>;
+					using reference = std::add_lvalue_reference_t<value_type>;
 
 					constexpr const_iterator() noexcept;
-					constexpr const_iterator(raw_iterator it);
-					constexpr const_iterator(raw_iterator::list_iterator_type list_iterator, raw_iterator::chunk_iterator_type ptr) noexcept;
+					constexpr const_iterator(raw_iterator it) noexcept;
 
 					constexpr const_iterator& operator++() noexcept;
 					constexpr const_iterator operator++(int) noexcept;
@@ -648,19 +998,31 @@ namespace my_adt
 					constexpr const_iterator& operator--() noexcept;
 					constexpr const_iterator operator--(int) noexcept;
 
-					constexpr bool operator==(raw_iterator other) const noexcept;
+					constexpr const_iterator& operator+=(difference_type n) noexcept;
+					constexpr const_iterator& operator-=(difference_type n) noexcept;
+					constexpr const_iterator operator+(difference_type n) const noexcept;
+					constexpr const_iterator operator-(difference_type n) const noexcept;
+					constexpr difference_type operator-(const_iterator other) const noexcept;
+
+					friend constexpr const_iterator operator+(difference_type n, const_iterator it) noexcept  { return it + n; }
+
+					template <typename Fn>
+					friend constexpr bool for_each_segment(const_iterator first, const_iterator last, Fn&& fn)  { return first.template walk_segments<const T*>(last, fn); }
+
 					constexpr bool operator==(iterator other) const noexcept;
 					constexpr bool operator==(const_iterator other) const noexcept;
 					constexpr bool operator==(reverse_iterator other) const noexcept;
 					constexpr bool operator==(const_reverse_iterator other) const noexcept;
+					constexpr std::strong_ordering operator<=>(const_iterator other) const noexcept;
 
-					constexpr reference operator*() noexcept;
-					constexpr pointer operator->() noexcept;
+					constexpr reference operator*() const noexcept;
+					constexpr pointer operator->() const noexcept;
+					constexpr reference operator[](difference_type n) const noexcept;
 
-					friend class stable_vector<T, Allocator, ChunkAllocator>;
+					friend class stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>;
 
-					template <typename U, typename SwapAllocator, typename SwapChunkAllocator>
-					friend constexpr void swap(stable_vector<U, SwapAllocator, SwapChunkAllocator>::const_iterator& a, stable_vector<U, SwapAllocator, SwapChunkAllocator>::const_iterator& b) noexcept;
+					template <typename U, typename SwapAllocator, typename SwapChunkAllocator, typename SwapGrowthPolicy, std::size_t SwapInlineCapacity>
+					friend constexpr void swap(stable_vector<U, SwapAllocator, SwapChunkAllocator, SwapGrowthPolicy, SwapInlineCapacity>::const_iterator& a, stable_vector<U, SwapAllocator, SwapChunkAllocator, SwapGrowthPolicy, SwapInlineCapacity>::const_iterator& b) noexcept;
 
 					friend class raw_iterator;
 					friend class iterator;
@@ -671,15 +1033,15 @@ namespace my_adt
 			class reverse_iterator : private raw_iterator
 			{						
 				public:
-					using iterator_category = std::bidirectional_iterator_tag;
+					using iterator_category = std::random_access_iterator_tag;
+					using iterator_concept = std::random_access_iterator_tag;
 					using value_type = raw_iterator::value_type;
 					using difference_type = raw_iterator::difference_type;
 					using pointer = raw_iterator::pointer;
 					using reference = raw_iterator::reference;
 
 					constexpr reverse_iterator() noexcept;
-					constexpr reverse_iterator(raw_iterator it);
-					constexpr reverse_iterator(raw_iterator::list_iterator_type list_iterator, raw_iterator::chunk_iterator_type ptr) noexcept;
+					constexpr reverse_iterator(raw_iterator it) noexcept;
 
 					constexpr reverse_iterator& operator++() noexcept;
 					constexpr reverse_iterator operator++(int) noexcept;
@@ -687,19 +1049,31 @@ namespace my_adt
 					constexpr reverse_iterator& operator--() noexcept;
 					constexpr reverse_iterator operator--(int) noexcept;
 
-					constexpr bool operator==(raw_iterator other) const noexcept;
+					constexpr reverse_iterator& operator+=(difference_type n) noexcept;
+					constexpr reverse_iterator& operator-=(difference_type n) noexcept;
+					constexpr reverse_iterator operator+(difference_type n) const noexcept;
+					constexpr reverse_iterator operator-(difference_type n) const noexcept;
+					constexpr difference_type operator-(reverse_iterator other) const noexcept;
+
+					friend constexpr reverse_iterator operator+(difference_type n, reverse_iterator it) noexcept  { return it + n; }
+
+					template <typename Fn>
+					friend constexpr bool for_each_segment(reverse_iterator first, reverse_iterator last, Fn&& fn)  { return first.template walk_segments_reverse<T*>(last, fn); }
+
 					constexpr bool operator==(iterator other) const noexcept;
 					constexpr bool operator==(const_iterator other) const noexcept;
 					constexpr bool operator==(reverse_iterator other) const noexcept;
 					constexpr bool operator==(const_reverse_iterator other) const noexcept;
+					constexpr std::strong_ordering operator<=>(reverse_iterator other) const noexcept;
 
-					constexpr reference operator*() noexcept;
-					constexpr pointer operator->() noexcept;
+					constexpr reference operator*() const noexcept;
+					constexpr pointer operator->() const noexcept;
+					constexpr reference operator[](difference_type n) const noexcept;
 
-					friend class stable_vector<T, Allocator, ChunkAllocator>;
+					friend class stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>;
 
-					template <typename U, typename SwapAllocator, typename SwapChunkAllocator>
-					friend constexpr void swap(stable_vector<U, SwapAllocator, SwapChunkAllocator>::reverse_iterator& a, stable_vector<U, SwapAllocator, SwapChunkAllocator>::reverse_iterator& b) noexcept;
+					template <typename U, typename SwapAllocator, typename SwapChunkAllocator, typename SwapGrowthPolicy, std::size_t SwapInlineCapacity>
+					friend constexpr void swap(stable_vector<U, SwapAllocator, SwapChunkAllocator, SwapGrowthPolicy, SwapInlineCapacity>::reverse_iterator& a, stable_vector<U, SwapAllocator, SwapChunkAllocator, SwapGrowthPolicy, SwapInlineCapacity>::reverse_iterator& b) noexcept;
 
 					friend class raw_iterator;
 					friend class iterator;
@@ -710,15 +1084,15 @@ namespace my_adt
 			class const_reverse_iterator : private raw_iterator
 			{						
 				public:
-					using iterator_category = std::bidirectional_iterator_tag;
+					using iterator_category = std::random_access_iterator_tag;
+					using iterator_concept = std::random_access_iterator_tag;
 					using value_type = std::add_const_t<typename raw_iterator::value_type>;
 					using difference_type = raw_iterator::difference_type;
 					using pointer = add_const_to_pointer_t<typename raw_iterator::pointer>;
-					using reference = std::add_const_t<typename raw_iterator::reference>;
+					using reference = std::add_lvalue_reference_t<value_type>;
 
 					constexpr const_reverse_iterator() noexcept;
-					constexpr const_reverse_iterator(raw_iterator it);
-					constexpr const_reverse_iterator(raw_iterator::list_iterator_type list_iterator, raw_iterator::chunk_iterator_type ptr) noexcept;
+					constexpr const_reverse_iterator(raw_iterator it) noexcept;
 
 					constexpr const_reverse_iterator& operator++() noexcept;
 					constexpr const_reverse_iterator operator++(int) noexcept;
@@ -726,19 +1100,31 @@ namespace my_adt
 					constexpr const_reverse_iterator& operator--() noexcept;
 					constexpr const_reverse_iterator operator--(int) noexcept;
 
-					constexpr bool operator==(raw_iterator other) const noexcept;
+					constexpr const_reverse_iterator& operator+=(difference_type n) noexcept;
+					constexpr const_reverse_iterator& operator-=(difference_type n) noexcept;
+					constexpr const_reverse_iterator operator+(difference_type n) const noexcept;
+					constexpr const_reverse_iterator operator-(difference_type n) const noexcept;
+					constexpr difference_type operator-(const_reverse_iterator other) const noexcept;
+
+					friend constexpr const_reverse_iterator operator+(difference_type n, const_reverse_iterator it) noexcept  { return it + n; }
+
+					template <typename Fn>
+					friend constexpr bool for_each_segment(const_reverse_iterator first, const_reverse_iterator last, Fn&& fn)  { return first.template walk_segments_reverse<const T*>(last, fn); }
+
 					constexpr bool operator==(iterator other) const noexcept;
 					constexpr bool operator==(const_iterator other) const noexcept;
 					constexpr bool operator==(reverse_iterator other) const noexcept;
 					constexpr bool operator==(const_reverse_iterator other) const noexcept;
+					constexpr std::strong_ordering operator<=>(const_reverse_iterator other) const noexcept;
 
-					constexpr reference operator*() noexcept;
-					constexpr pointer operator->() noexcept;
+					constexpr reference operator*() const noexcept;
+					constexpr pointer operator->() const noexcept;
+					constexpr reference operator[](difference_type n) const noexcept;
 
-					friend class stable_vector<T, Allocator, ChunkAllocator>;
+					friend class stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>;
 
-					template <typename U, typename SwapAllocator, typename SwapChunkAllocator>
-					friend constexpr void swap(stable_vector<U, SwapAllocator, SwapChunkAllocator>::const_reverse_iterator& a, stable_vector<U, SwapAllocator, SwapChunkAllocator>::const_reverse_iterator& b) noexcept;
+					template <typename U, typename SwapAllocator, typename SwapChunkAllocator, typename SwapGrowthPolicy, std::size_t SwapInlineCapacity>
+					friend constexpr void swap(stable_vector<U, SwapAllocator, SwapChunkAllocator, SwapGrowthPolicy, SwapInlineCapacity>::const_reverse_iterator& a, stable_vector<U, SwapAllocator, SwapChunkAllocator, SwapGrowthPolicy, SwapInlineCapacity>::const_reverse_iterator& b) noexcept;
 
 					friend class raw_iterator;
 					friend class iterator;
@@ -747,1155 +1133,1563 @@ namespace my_adt
 			};
 	};
 
+	// a stable_vector whose first N elements live inside the object; they stay put as long as the container itself is not moved
+	template <typename T, std::size_t N, typename Allocator = std::allocator<T>>
+	using small_stable_vector = stable_vector<T, Allocator, std::allocator<T*>, geometric_growth<>, N>;
 
-
-
-	namespace detail
+	// containers whose elements and chunk directory both come from one std::pmr::memory_resource; pointed at a
+	// std::pmr::monotonic_buffer_resource, any number of containers are freed at once by releasing the resource
+	namespace pmr
 	{
-		template <typename T, typename Allocator>
-		constexpr void swap(vector_chunk<T, Allocator>& a, vector_chunk<T, Allocator>& b) noexcept
-		{
-			std::swap(a.m_begin, b.m_begin);
-			std::swap(a.m_size, b.m_size);
-			std::swap(a.m_capacity, b.m_capacity);
-			swap(a.m_allocator, b.m_allocator);
-		}
-
-		template <typename T, typename Allocator>
-		constexpr void vector_chunk<T, Allocator>::update_deleter_size() noexcept
-		{
-			m_begin.get_deleter().update_size(m_size);
-			m_begin.get_deleter().update_capacity(m_capacity);
-		}
+		template <typename T, typename GrowthPolicy = geometric_growth<>, std::size_t InlineCapacity = 0>
+		using stable_vector = my_adt::stable_vector<T, std::pmr::polymorphic_allocator<T>, std::pmr::polymorphic_allocator<T*>, GrowthPolicy, InlineCapacity>;
 
-		template <typename T, typename Allocator>
-		constexpr void detail::vector_chunk<T, Allocator>::copy_initialize(const vector_chunk<T, Allocator>& other)
-		{
-			std::size_t new_capacity = other.m_size;
-			m_begin_pointer new_begin(std::allocator_traits<Allocator>::allocate(m_allocator, new_capacity), chunk_deleter{m_allocator, 0, new_capacity});
+		template <typename T, std::size_t N>
+		using small_stable_vector = stable_vector<T, geometric_growth<>, N>;
+	}
 
-			std::uninitialized_copy(other.begin(), other.end(), new_begin);
 
-			m_begin = std::move(new_begin);
 
-			m_capacity = other.m_size;
-			m_size = other.m_size;
 
-			update_deleter_size();
-		}
 
-		template <typename T, typename Allocator>
-		constexpr detail::vector_chunk<T, Allocator>::raw_iterator detail::vector_chunk<T, Allocator>::raw_begin() noexcept
-		{
-			return raw_iterator{m_begin.get()};
-		}
 
-		template <typename T, typename Allocator>
-		constexpr detail::vector_chunk<T, Allocator>::raw_iterator detail::vector_chunk<T, Allocator>::raw_end() noexcept
-		{
-			return raw_iterator{m_begin.get() + m_size};
-		}
 
-		template <typename T, typename Allocator>
-		constexpr detail::vector_chunk<T, Allocator>::raw_iterator detail::vector_chunk<T, Allocator>::raw_cap_end() noexcept
-		{
-			return raw_iterator{m_begin.get() + m_capacity};
-		}
 
-		template <typename T, typename Allocator>
-		constexpr detail::vector_chunk<T, Allocator>::raw_iterator detail::vector_chunk<T, Allocator>::raw_before_end() noexcept
-		{
-			if (empty()) return raw_begin();
-			else return std::prev(raw_end());
-		}
 
-		template <typename T, typename Allocator>
-		constexpr detail::vector_chunk<T, Allocator>::raw_iterator detail::vector_chunk<T, Allocator>::raw_before_begin() noexcept
-		{
-			if (empty()) return raw_begin();
-			else return std::prev(raw_begin());
-		}
 
-		template <typename T, typename Allocator>
-		constexpr detail::vector_chunk<T, Allocator>::vector_chunk() : m_allocator{}, m_begin{nullptr, chunk_deleter{m_allocator, 0, 0}}, m_size{0}, m_capacity{0} {}
+	
 
-		template <typename T, typename Allocator>
-		constexpr detail::vector_chunk<T, Allocator>::vector_chunk(const Allocator& other) : m_allocator{other}, m_begin{nullptr, chunk_deleter{m_allocator, 0, 0}}, m_size{0}, m_capacity{0} {}
+	
 
-		template <typename T, typename Allocator>
-		constexpr detail::vector_chunk<T, Allocator>::vector_chunk(std::size_t n, size_tag, const Allocator& allocator) : vector_chunk{allocator}
-		{
-			m_begin_pointer new_begin(std::allocator_traits<Allocator>::allocate(m_allocator, n), chunk_deleter{m_allocator, 0, n});
-			std::uninitialized_default_construct_n(new_begin, n);
 
-			m_begin = std::move(new_begin);
 
-			m_capacity = n;
-			m_size = n;
 
-			update_deleter_size();
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity> 
+	constexpr void swap(stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>& a, stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>& b) noexcept
+	{
+		// chunks must go back to the allocator they came from, so allocators either travel with them or, as with the
+		// standard containers, have to be equal
+		if constexpr (std::allocator_traits<Allocator>::propagate_on_container_swap::value)
+		{
+			using std::swap;
+			swap(a.m_allocator, b.m_allocator);
 		}
-
-		template <typename T, typename Allocator>
-		constexpr detail::vector_chunk<T, Allocator>::vector_chunk(std::size_t n, capacity_tag, const Allocator& allocator) : vector_chunk{allocator}
+		else
 		{
-			if (n > 0)
-			{
-				m_begin_pointer new_begin(std::allocator_traits<Allocator>::allocate(m_allocator, n), chunk_deleter{m_allocator, 0, n});
+			assert(a.m_allocator == b.m_allocator);
+		}
+		assert(std::allocator_traits<ChunkAllocator>::propagate_on_container_swap::value || a.m_chunks.get_allocator() == b.m_chunks.get_allocator());
 
-				m_begin = std::move(new_begin);
-				
-				m_capacity = n;
-				// m_size = 0
+		std::swap(a.m_chunks, b.m_chunks);
+		std::swap(a.m_chunk_ends, b.m_chunk_ends);
+		std::swap(a.m_size, b.m_size);
+		std::swap(a.m_capacity, b.m_capacity);
+		std::swap(a.m_tail_chunk, b.m_tail_chunk);
+		std::swap(a.m_retained_limit, b.m_retained_limit);
+		a.reset_tail_cursor();
+		b.reset_tail_cursor();
 
-				update_deleter_size();
+		if constexpr (InlineCapacity != 0)
+		{
+			// each swapped directory's first chunk may still point into the other container's inline buffer
+			bool a_borrows = !a.m_chunks.empty() && a.m_chunks.front() == b.m_inline.data();
+			bool b_borrows = !b.m_chunks.empty() && b.m_chunks.front() == a.m_inline.data();
+			if (a_borrows && b_borrows)
+			{
+				detail::inline_chunk_storage<T, InlineCapacity> scratch;
+				a.relocate_first_chunk(scratch.data());
+				b.relocate_first_chunk(b.m_inline.data());
+				a.relocate_first_chunk(a.m_inline.data());
+			}
+			else if (a_borrows)
+			{
+				a.relocate_first_chunk(a.m_inline.data());
+			}
+			else if (b_borrows)
+			{
+				b.relocate_first_chunk(b.m_inline.data());
 			}
 		}
+	}
 
-		template <typename T, typename Allocator>
-		template <typename It>
-		constexpr detail::vector_chunk<T, Allocator>::vector_chunk(It first, It last, const Allocator& allocator) : vector_chunk{allocator}
-		{
-			std::size_t size = std::distance(first, last);
-			m_begin_pointer new_begin(std::allocator_traits<Allocator>::allocate(m_allocator, size), chunk_deleter{m_allocator, 0, size});
-
-			std::uninitialized_copy(first, last, new_begin.get());
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	constexpr stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::stable_vector(uninit_tag) : m_allocator{}, m_chunks{}, m_chunk_ends{}, m_size{0}, m_capacity{0}, m_tail_chunk{0}, m_tail_next{nullptr}, m_tail_last{nullptr}, m_retained_limit{0}  {}
 
-			m_begin = std::move(new_begin);
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	constexpr stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::stable_vector(uninit_tag, const Allocator& allocator) : stable_vector{uninit_tag{}, allocator, chunk_allocator_for(allocator)}  {}
 
-			m_capacity = size;
-			m_size = size;
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	constexpr stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::stable_vector(uninit_tag, const Allocator& allocator,
+																			 const ChunkAllocator& chunk_allocator) : m_allocator{allocator}, m_chunks{chunk_allocator}, m_chunk_ends{chunk_allocator}, m_size{0}, m_capacity{0}, m_tail_chunk{0}, m_tail_next{nullptr}, m_tail_last{nullptr}, m_retained_limit{0}  {}
 
-			update_deleter_size();
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	constexpr ChunkAllocator stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::chunk_allocator_for(const Allocator& allocator)
+	{
+		if constexpr (std::is_constructible_v<ChunkAllocator, const Allocator&>)
+		{
+			return ChunkAllocator(allocator);
 		}
-
-		template <typename T, typename Allocator>
-		constexpr detail::vector_chunk<T, Allocator>::vector_chunk(std::initializer_list<T> init_list, const Allocator& allocator) : vector_chunk{init_list.begin(), init_list.end(), allocator}  {}
-
-		template <typename T, typename Allocator>
-		template <typename Begin, typename Sent>
-		constexpr detail::vector_chunk<T, Allocator>::vector_chunk(std::from_range_t, Begin first, Sent last, const Allocator& allocator) : vector_chunk{allocator}
+		else
 		{
-			std::size_t size = std::ranges::distance(first, last);
-			m_begin_pointer new_begin(std::allocator_traits<Allocator>::allocate(m_allocator, size), chunk_deleter{m_allocator, 0, size});
-
-			std::ranges::uninitialized_copy(first, last, new_begin.get(), new_begin.get() + size);
-
-			m_begin = std::move(new_begin);
-
-			m_capacity = size;
-			m_size = size;
-
-			update_deleter_size();
+			return ChunkAllocator{};
 		}
+	}
 
-		template <typename T, typename Allocator>
-		template <typename Range>
-		constexpr detail::vector_chunk<T, Allocator>::vector_chunk(std::from_range_t, Range&& range, const Allocator& allocator) : vector_chunk{range.begin(), range.end(), allocator}  {}
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	constexpr void stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::copy_initialize(const stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>& other)
+	{
+		append_from<false>(other);
+	}
 
-		template <typename T, typename Allocator>
-		constexpr detail::vector_chunk<T, Allocator>::vector_chunk(const vector_chunk<T, Allocator>& other) : vector_chunk{Allocator{}}
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	constexpr void stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::move_initialize(stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>& other)
+	{
+		// chunks can only change hands when each side's allocators can free the other's memory
+		if (m_allocator == other.m_allocator && m_chunks.get_allocator() == other.m_chunks.get_allocator())
 		{
-			copy_initialize(other);
+			m_chunks.swap(other.m_chunks);
+			m_chunk_ends.swap(other.m_chunk_ends);
+			std::swap(m_size, other.m_size);
+			std::swap(m_capacity, other.m_capacity);
+			std::swap(m_tail_chunk, other.m_tail_chunk);
+			reset_tail_cursor();
+			other.reset_tail_cursor();
+
+			take_inline_chunk(other);
 		}
-
-		template <typename T, typename Allocator>
-		constexpr detail::vector_chunk<T, Allocator>::vector_chunk(const vector_chunk<T, Allocator>& other, const std::type_identity<Allocator>& allocator) : vector_chunk{allocator}
+		else
 		{
-			copy_initialize(other);
+			append_from<true>(other);
 		}
+		m_retained_limit = other.m_retained_limit;
+	}
 
-		template <typename T, typename Allocator>
-		constexpr detail::vector_chunk<T, Allocator>::vector_chunk(detail::vector_chunk<T, Allocator>&& other) : m_allocator(Allocator{}), m_begin(std::move(other.m_begin)),
-																												m_size(other.m_size), m_capacity(other.m_capacity)
-		{
-			other.m_size = 0;
-			other.m_capacity = 0;
-		}
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	template <bool Move>
+	constexpr void stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::append_from(const stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>& other)
+	{
+		using source_pointer = std::conditional_t<Move, T*, const T*>;
 
-		template <typename T, typename Allocator>
-		constexpr detail::vector_chunk<T, Allocator>::vector_chunk(detail::vector_chunk<T, Allocator>&& other,
-																const std::type_identity<Allocator>& allocator) : m_allocator(allocator), m_begin(std::move(other.begin())),
-																													m_size(other.m_size), m_capacity(other.m_capacity)
+		// the source may have reserved chunks of other sizes, so fill each destination chunk piecewise from the source's chunks
+		append_chunks(other.size(), [this, &other](T* dest, std::size_t start, std::size_t count)
 		{
-			other.m_size = 0;
-			other.m_capacity = 0;
-		}
+			raw_iterator first = other.raw_begin();
+			first += start;
+			raw_iterator last = first;
+			last += count;
 
-		template <typename T, typename Allocator>
-		constexpr detail::vector_chunk<T, Allocator>& detail::vector_chunk<T, Allocator>::operator=(vector_chunk<T, Allocator> other)
-		{
-			swap(*this, other);
-			return *this;
-		}
+			T* current = dest;
+			auto transfer_segment = [this, &current](source_pointer segment_first, source_pointer segment_last)
+			{
+				// moving a trivially copyable element is a copy, which keeps the memcpy path open
+				std::size_t segment_size = static_cast<std::size_t>(segment_last - segment_first);
+				if constexpr (Move && !std::is_trivially_copyable_v<T>)
+				{
+					detail::uninitialized_copy_advance(m_allocator, std::make_move_iterator(segment_first), segment_size, current);
+				}
+				else
+				{
+					detail::uninitialized_copy_advance(m_allocator, segment_first, segment_size, current);
+				}
+				current += segment_size;
+				return true;
+			};
 
-		template <typename T, typename Allocator>
-		constexpr detail::vector_chunk<T, Allocator>& detail::vector_chunk<T, Allocator>::operator=(std::initializer_list<T> init_list)
-		{
-			static_assert(false);
-		}
+			try { first.template walk_segments<source_pointer>(last, transfer_segment); }
+			catch (...)
+			{
+				detail::destroy(m_allocator, dest, current);
+				throw;
+			}
+		});
+	}
+
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	template <typename Fill>
+	constexpr void stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::append_chunks(std::size_t n, Fill fill)
+	{
+		// expects every existing chunk to be full, so the new elements start a fresh chunk
+		assert(m_size == m_capacity);
 
-		template <typename T, typename Allocator>
-		template <typename... Args>
-		constexpr bool detail::vector_chunk<T, Allocator>::emplace_back(Args&&... args)
+		while (n > 0)
 		{
-			if (full())
+			std::size_t capacity = next_chunk_capacity();
+			std::size_t count = std::min(capacity, n);
+
+			push_chunk(capacity);
+
+			try { fill(m_chunks.back(), m_size, count); }
+			catch (...)
 			{
-				return false;
+				truncate_chunks(m_chunks.size() - 1);
+				throw;
 			}
-			else
-			{
-				std::allocator_traits<Allocator>::construct(m_allocator, m_begin.get() + m_size, std::forward<Args>(args)...);
-				m_size++;
-				update_deleter_size();
 
-				return true;
+			m_size += count;
+			n -= count;
+			if (m_size == m_capacity)
+			{
+				m_tail_chunk++;
 			}
 		}
+		reset_tail_cursor();
+	}
 
-		template <typename T, typename Allocator>
-		constexpr bool detail::vector_chunk<T, Allocator>::push_back(const T& val)
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	constexpr std::span<T> stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::grow_for_overwrite(std::size_t n) requires std::is_trivially_default_constructible_v<T>
+	{
+		if (n == 0)
+		{
+			return {};
+		}
+		if (full())
 		{
-			return emplace_back(val);
+			push_chunk(std::max(n, next_chunk_capacity()));
 		}
 
-		template <typename T, typename Allocator>
-		constexpr bool detail::vector_chunk<T, Allocator>::push_back(T&& val)
+		T* first = m_chunks[m_tail_chunk] + (m_size - chunk_start_of(m_tail_chunk));
+		std::size_t count = std::min(n, chunk_end_of(m_tail_chunk) - m_size);
+		detail::uninitialized_default_construct_n(m_allocator, first, count);
+
+		m_size += count;
+		if (m_size == chunk_end_of(m_tail_chunk))
 		{
-			return emplace_back(std::move(val));
+			m_tail_chunk++;
 		}
+		reset_tail_cursor();
+		return std::span<T>{first, count};
+	}
 
-		template <typename T, typename Allocator>
-		constexpr bool detail::vector_chunk<T, Allocator>::pop_back()
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	template <typename Fn>
+	constexpr void stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::append_uninitialized(std::size_t n, Fn fn) requires std::is_trivially_default_constructible_v<T>
+	{
+		// a throwing fn drops the piece it was given, while earlier pieces stay appended
+		append_filled(n, [this, &fn](T* dest, std::size_t, std::size_t count)
 		{
-			if (m_size == 0)
-			{
-				return false;
-			}
-			else
+			detail::uninitialized_default_construct_n(m_allocator, dest, count);
+			try { fn(std::span<T>{dest, count}); }
+			catch (...)
 			{
-				std::allocator_traits<Allocator>::destroy(m_allocator, m_begin.get() + m_size - 1);
-				m_size--;
-				update_deleter_size();
-				
-				return true;
+				detail::destroy(m_allocator, dest, dest + count);
+				throw;
 			}
-		}
+		});
+	}
 
-		template <typename T, typename Allocator>
-		constexpr bool detail::vector_chunk<T, Allocator>::resize(std::size_t n) noexcept
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	template <typename Fill>
+	constexpr void stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::append_filled(std::size_t n, Fill fill)
+	{
+		try
 		{
-			if (n > m_capacity)
+			// an unused inline buffer is free capacity too
+			if (InlineCapacity != 0 && n > 0 && m_chunks.empty())
 			{
-				return false;
+				push_chunk(InlineCapacity);
 			}
-			else if (n < m_size)
-			{
-				for (std::size_t index = n; index < m_size; index++)
-				{
-					std::allocator_traits<Allocator>::destroy(m_allocator, m_begin.get() + index);
-					m_size = n;
 
-					update_deleter_size();
-				}
-			}
-			else if (n > m_size)
+			// free slots of the tail chunk, and of any chunks reserved or retained past it
+			while (n > 0 && m_tail_chunk < m_chunks.size())
 			{
-				for (std::size_t index = m_size; index < n; index++)
-				{
-					std::allocator_traits<Allocator>::construct(m_allocator, m_begin.get() + index);
-					m_size = n;
+				std::size_t count = std::min(n, chunk_end_of(m_tail_chunk) - m_size);
+				fill(m_chunks[m_tail_chunk] + (m_size - chunk_start_of(m_tail_chunk)), m_size, count);
 
-					update_deleter_size();
+				m_size += count;
+				n -= count;
+				if (m_size == chunk_end_of(m_tail_chunk))
+				{
+					m_tail_chunk++;
 				}
 			}
-			return true;
-		}
 
-		template <typename T, typename Allocator>
-		constexpr void detail::vector_chunk<T, Allocator>::clear() noexcept
-		{
-			for (std::size_t index = 0; index < m_size; index++)
+			if (n > 0)
 			{
-				std::allocator_traits<Allocator>::destroy(m_allocator, m_begin.get() + index);
+				push_chunk(std::max(n, next_chunk_capacity()));
+				fill(m_chunks.back(), m_size, n);
+
+				m_size += n;
+				if (m_size == m_capacity)
+				{
+					m_tail_chunk++;
+				}
 			}
-			m_size = 0;
-			update_deleter_size();
 		}
-
-		template <typename T, typename Allocator>
-		constexpr bool detail::vector_chunk<T, Allocator>::empty() const noexcept
+		catch (...)
 		{
-			return m_size == 0;
+			// elements appended before the failure stay
+			reset_tail_cursor();
+			throw;
 		}
+		reset_tail_cursor();
+	}
 
-		template <typename T, typename Allocator>
-		constexpr bool detail::vector_chunk<T, Allocator>::full() const noexcept
-		{
-			return m_size == m_capacity;
-		}
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	constexpr void stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::push_chunk(std::size_t size)
+	{
+		// the inline buffer is always the first chunk; a larger first request allocates only the rest, as a second chunk
+		bool use_inline = InlineCapacity != 0 && m_chunks.empty();
+		std::size_t n = use_inline ? InlineCapacity : size;
+		T* buffer = use_inline ? m_inline.data() : std::allocator_traits<Allocator>::allocate(m_allocator, n);
 
-		template <typename T, typename Allocator>
-		constexpr bool detail::vector_chunk<T, Allocator>::has_capacity() const noexcept
+		try
 		{
-			return m_capacity != 0;
+			m_chunks.push_back(buffer);
+			m_chunk_ends.push_back(m_capacity + n);
 		}
-
-		template <typename T, typename Allocator>
-		constexpr detail::vector_chunk<T, Allocator>::iterator detail::vector_chunk<T, Allocator>::begin()
+		catch (...)
 		{
-			return iterator{raw_begin()};
+			if (m_chunks.size() > m_chunk_ends.size())
+			{
+				m_chunks.pop_back();
+			}
+			if (!use_inline)
+			{
+				std::allocator_traits<Allocator>::deallocate(m_allocator, buffer, n);
+			}
+			throw;
 		}
 
-		template <typename T, typename Allocator>
-		constexpr detail::vector_chunk<T, Allocator>::iterator detail::vector_chunk<T, Allocator>::end()
-		{
-			return iterator{raw_end()};
-		}
+		m_capacity += n;
+		reset_tail_cursor();
 
-		template <typename T, typename Allocator>
-		constexpr detail::vector_chunk<T, Allocator>::iterator detail::vector_chunk<T, Allocator>::cap_end()
+		if (size > n)
 		{
-			return iterator{raw_cap_end()};
+			push_chunk(size - n);
 		}
+	}
 
-		template <typename T, typename Allocator>
-		constexpr vector_chunk<T, Allocator>::const_iterator vector_chunk<T, Allocator>::cbegin() const
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	constexpr void stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::take_inline_chunk(stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>& other)
+	{
+		// a directory taken from other may start with a chunk living in other's inline buffer
+		if constexpr (InlineCapacity != 0)
 		{
-			return const_iterator{raw_begin()};
+			if (!m_chunks.empty() && m_chunks.front() == other.m_inline.data())
+			{
+				relocate_first_chunk(m_inline.data());
+			}
 		}
+	}
 
-		template <typename T, typename Allocator>
-		constexpr vector_chunk<T, Allocator>::const_iterator vector_chunk<T, Allocator>::cend() const
-		{
-			return const_iterator{raw_end()};
-		}
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	constexpr void stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::relocate_first_chunk(T* buffer)
+	{
+		static_assert(std::is_move_constructible_v<T>, "moving or swapping a stable_vector with an inline chunk relocates its inline elements");
 
-		template <typename T, typename Allocator>
-		constexpr vector_chunk<T, Allocator>::const_iterator vector_chunk<T, Allocator>::ccap_end() const
+		// moves the first chunk's elements into another buffer of the same capacity, leaving the old one empty
+		std::size_t count = chunk_span(0).size();
+		if constexpr (std::is_trivially_copyable_v<T>)
 		{
-			return const_iterator{raw_cap_end()};
+			detail::uninitialized_copy_advance(m_allocator, m_chunks.front(), count, buffer);
 		}
-
-		template <typename T, typename Allocator>
-		constexpr vector_chunk<T, Allocator>::reverse_iterator vector_chunk<T, Allocator>::rbegin()
+		else
 		{
-			return reverse_iterator{raw_before_end()};
+			detail::uninitialized_copy_advance(m_allocator, std::make_move_iterator(m_chunks.front()), count, buffer);
 		}
+		detail::destroy(m_allocator, m_chunks.front(), m_chunks.front() + count);
+		m_chunks.front() = buffer;
+		reset_tail_cursor();
+	}
 
-		template <typename T, typename Allocator>
-		constexpr vector_chunk<T, Allocator>::reverse_iterator vector_chunk<T, Allocator>::rend()
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	constexpr void stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::truncate_chunks(std::size_t chunk_count)
+	{
+		// the tail chunk index stays valid since callers never drop a chunk holding elements
+		while (m_chunks.size() > chunk_count)
 		{
-			return reverse_iterator{raw_before_begin()};
+			std::size_t chunk_index = m_chunks.size() - 1;
+			if (m_chunks.back() != m_inline.data())
+			{
+				std::allocator_traits<Allocator>::deallocate(m_allocator, m_chunks.back(), chunk_end_of(chunk_index) - chunk_start_of(chunk_index));
+			}
+			m_chunks.pop_back();
+			m_chunk_ends.pop_back();
 		}
+		m_capacity = m_chunk_ends.empty() ? 0 : m_chunk_ends.back();
+		reset_tail_cursor();
+	}
 
-		template <typename T, typename Allocator>
-		constexpr vector_chunk<T, Allocator>::const_reverse_iterator vector_chunk<T, Allocator>::crbegin() const
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	constexpr void stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::destroy_elements(std::size_t first) noexcept
+	{
+		if constexpr (!std::is_trivially_destructible_v<T>)
 		{
-			return const_reverse_iterator{raw_before_end()};
+			if (first < m_size)
+			{
+				for (std::size_t chunk_index = chunk_index_of(first), count = segment_count(); chunk_index < count; chunk_index++)
+				{
+					std::size_t chunk_start = chunk_start_of(chunk_index);
+					for (T& elem : chunk_span(chunk_index).subspan(first > chunk_start ? first - chunk_start : 0))
+					{
+						std::allocator_traits<Allocator>::destroy(m_allocator, std::addressof(elem));
+					}
+				}
+			}
 		}
+		m_size = first;
+		m_tail_chunk = chunk_index_of(first);
+		reset_tail_cursor();
+	}
 
-		template <typename T, typename Allocator>
-		constexpr vector_chunk<T, Allocator>::const_reverse_iterator vector_chunk<T, Allocator>::crend() const
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	constexpr void stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::reset_tail_cursor() noexcept
+	{
+		if (m_tail_chunk < m_chunks.size())
 		{
-			return const_reverse_iterator{raw_before_begin()};
+			T* chunk_data = m_chunks[m_tail_chunk];
+			std::size_t chunk_start = chunk_start_of(m_tail_chunk);
+			m_tail_next = chunk_data + (m_size - chunk_start);
+			m_tail_last = chunk_data + (chunk_end_of(m_tail_chunk) - chunk_start - 1);
 		}
-
-
-
-
-
-		template <typename T, typename Allocator>
-		constexpr detail::vector_chunk<T, Allocator>::raw_iterator::raw_iterator() noexcept : m_ptr{nullptr}  {}
-
-		template <typename T, typename Allocator>
-		constexpr detail::vector_chunk<T, Allocator>::raw_iterator::raw_iterator(pointer ptr) noexcept : m_ptr{ptr}  {}
-
-		template <typename T, typename Allocator>
-		constexpr detail::vector_chunk<T, Allocator>::raw_iterator& detail::vector_chunk<T, Allocator>::raw_iterator::operator++() noexcept
+		else
 		{
-			m_ptr++;
-			return *this;
+			m_tail_next = nullptr;
+			m_tail_last = nullptr;
 		}
+	}
 
-		template <typename T, typename Allocator>
-		constexpr detail::vector_chunk<T, Allocator>::raw_iterator detail::vector_chunk<T, Allocator>::raw_iterator::operator++(int) noexcept
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	constexpr std::size_t stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::next_chunk_capacity() const noexcept
+	{
+		if (InlineCapacity != 0 && m_chunks.empty())
 		{
-			return raw_iterator(m_ptr++);
+			return InlineCapacity;
 		}
+		return GrowthPolicy::next_chunk_capacity(m_capacity, sizeof(T));
+	}
 
-		template <typename T, typename Allocator>
-		constexpr detail::vector_chunk<T, Allocator>::raw_iterator& detail::vector_chunk<T, Allocator>::raw_iterator::operator--() noexcept
-		{
-			m_ptr--;
-			return *this;
-		}
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	constexpr bool stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::has_capacity() const noexcept
+	{
+		return m_capacity != 0;
+	}
 
-		template <typename T, typename Allocator>
-		constexpr detail::vector_chunk<T, Allocator>::raw_iterator detail::vector_chunk<T, Allocator>::raw_iterator::operator--(int) noexcept
-		{
-			return raw_iterator(m_ptr--);
-		}
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	constexpr bool stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::full() const noexcept
+	{
+		return m_size == m_capacity;
+	}
 
-		template <typename T, typename Allocator>
-		constexpr bool detail::vector_chunk<T, Allocator>::raw_iterator::operator==(raw_iterator other) const noexcept
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	constexpr std::size_t stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::chunk_index_of(std::size_t index) const noexcept
+	{
+		if (InlineCapacity != 0 && !m_chunk_ends.empty() && index < m_chunk_ends.front())
 		{
-			return m_ptr == other.m_ptr;
+			return 0;
 		}
-
-		template <typename T, typename Allocator>
-		constexpr bool detail::vector_chunk<T, Allocator>::raw_iterator::operator==(iterator other) const noexcept
+		if constexpr (indexed_growth_policy<GrowthPolicy>)
 		{
-			return operator==(static_cast<raw_iterator>(other));
+			std::size_t guess = GrowthPolicy::chunk_index_of(index, sizeof(T));
+			if constexpr (InlineCapacity != 0)
+			{
+				// the inline chunk stands in for the policy's chunks below its end, which for a power of two lines the later
+				// chunks up with the policy's again
+				guess = m_chunk_ends.empty() ? 0 : guess + 1 - GrowthPolicy::chunk_index_of(m_chunk_ends.front(), sizeof(T));
+			}
+			if (guess < m_chunk_ends.size() && index < m_chunk_ends[guess] && chunk_start_of(guess) <= index)
+			{
+				return guess;
+			}
 		}
 
-		template <typename T, typename Allocator>
-		constexpr bool detail::vector_chunk<T, Allocator>::raw_iterator::operator==(const_iterator other) const noexcept
-		{
-			return operator==(static_cast<raw_iterator>(other));
-		}
+		// indices at or past the capacity map to m_chunks.size()
+		return static_cast<std::size_t>(std::upper_bound(m_chunk_ends.begin(), m_chunk_ends.end(), index) - m_chunk_ends.begin());
+	}
 
-		template <typename T, typename Allocator>
-		constexpr bool detail::vector_chunk<T, Allocator>::raw_iterator::operator==(reverse_iterator other) const noexcept
-		{
-			return operator==(static_cast<raw_iterator>(other));
-		}
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	constexpr std::size_t stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::chunk_start_of(std::size_t chunk_index) const noexcept
+	{
+		return chunk_index == 0 ? 0 : m_chunk_ends[chunk_index - 1];
+	}
 
-		template <typename T, typename Allocator>
-		constexpr bool detail::vector_chunk<T, Allocator>::raw_iterator::operator==(const_reverse_iterator other) const noexcept
-		{
-			return operator==(static_cast<raw_iterator>(other));
-		}
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	constexpr std::size_t stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::chunk_end_of(std::size_t chunk_index) const noexcept
+	{
+		return m_chunk_ends[chunk_index];
+	}
 
-		template <typename T, typename Allocator>
-		constexpr detail::vector_chunk<T, Allocator>::raw_iterator::reference detail::vector_chunk<T, Allocator>::raw_iterator::operator*() noexcept
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	constexpr std::size_t stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::inline_chunk_capacity() const noexcept
+	{
+		if constexpr (InlineCapacity != 0)
 		{
-			return *m_ptr;
+			if (!m_chunks.empty() && m_chunks.front() == m_inline.data())
+			{
+				return InlineCapacity;
+			}
 		}
+		return 0;
+	}
 
-		template <typename T, typename Allocator>
-		constexpr detail::vector_chunk<T, Allocator>::raw_iterator::pointer detail::vector_chunk<T, Allocator>::raw_iterator::operator->() noexcept
-		{
-			return m_ptr;
-		}
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	constexpr std::span<T> stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::chunk_span(std::size_t chunk_index) const noexcept
+	{
+		// the elements chunk k holds: all of it below the tail, a prefix at the tail, nothing past it
+		std::size_t chunk_start = chunk_start_of(chunk_index);
+		std::size_t chunk_end = std::min(chunk_end_of(chunk_index), std::max(m_size, chunk_start));
+		return std::span<T>{m_chunks[chunk_index], chunk_end - chunk_start};
+	}
 
-		template <typename T, typename Allocator>
-		constexpr void swap(typename vector_chunk<T, Allocator>::raw_iterator& a, typename vector_chunk<T, Allocator>::raw_iterator& b) noexcept
-		{
-			std::swap(a.m_ptr, b.m_ptr);
-		}
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	constexpr std::size_t stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::segment_count() const noexcept
+	{
+		bool tail_in_use = m_tail_chunk < m_chunks.size() && chunk_start_of(m_tail_chunk) < m_size;
+		return tail_in_use ? m_tail_chunk + 1 : m_tail_chunk;
+	}
 
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	constexpr stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::stable_vector() : stable_vector{uninit_tag{}}  {}
 
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	constexpr stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::stable_vector(const Allocator& allocator) : stable_vector{uninit_tag{}, allocator}  {}
 
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	constexpr stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::stable_vector(const Allocator& allocator, const ChunkAllocator& chunk_allocator) : stable_vector{uninit_tag{}, allocator, chunk_allocator}  {}
 
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	constexpr stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::stable_vector(std::size_t n, const Allocator& allocator, const ChunkAllocator& chunk_allocator) : stable_vector{uninit_tag{}, allocator, chunk_allocator}
+	{
+		append_chunks(n, [this](T* dest, std::size_t, std::size_t count)
+		{
+			detail::uninitialized_default_construct_n(m_allocator, dest, count);
+		});
+	}
 
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	template <typename It>
+	constexpr stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::stable_vector(It first, It last, const Allocator& allocator, const ChunkAllocator& chunk_allocator) : stable_vector{uninit_tag{}, allocator, chunk_allocator}
+	{
+		append_chunks(std::distance(first, last), [this, &first](T* dest, std::size_t, std::size_t count)
+		{
+			first = detail::uninitialized_copy_advance(m_allocator, first, count, dest);
+		});
+	}
 
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	constexpr stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::stable_vector(std::initializer_list<T> init_list, const Allocator& allocator,
+																			 const ChunkAllocator& chunk_allocator) : stable_vector{init_list.begin(), init_list.end(), allocator, chunk_allocator}  {}
+	
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	template <typename Begin, typename Sent>
+	constexpr stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::stable_vector(std::from_range_t, Begin first, Sent last,
+																			 const Allocator& allocator, const ChunkAllocator& chunk_allocator) : stable_vector{uninit_tag{}, allocator, chunk_allocator}
+	{
+		append_chunks(std::ranges::distance(first, last), [this, &first](T* dest, std::size_t, std::size_t count)
+		{
+			first = detail::uninitialized_copy_advance(m_allocator, first, count, dest);
+		});
+	}
 
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	template <typename Range>
+	constexpr stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::stable_vector(std::from_range_t, Range&& range, const Allocator& allocator,
+																			 const ChunkAllocator& chunk_allocator) : stable_vector{std::from_range_t{}, std::ranges::begin(range),
+																			 														   std::ranges::end(range), allocator, chunk_allocator}  {}
 
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	constexpr stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::stable_vector(const stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>& other)
+		: stable_vector{uninit_tag{}, std::allocator_traits<Allocator>::select_on_container_copy_construction(other.m_allocator),
+						std::allocator_traits<ChunkAllocator>::select_on_container_copy_construction(ChunkAllocator(other.m_chunks.get_allocator()))}
+	{
+		copy_initialize(other);
+	}
 
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	constexpr stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::stable_vector(const stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>& other, const std::type_identity_t<Allocator>& allocator) : stable_vector{uninit_tag{}, allocator}
+	{
+		copy_initialize(other);
+	}
 
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	constexpr stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::stable_vector(const stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>& other, const std::type_identity_t<Allocator>& allocator,
+																			 const std::type_identity_t<ChunkAllocator>& chunk_allocator) : stable_vector{uninit_tag{}, allocator, chunk_allocator}
+	{
+		copy_initialize(other);
+	}
 
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	constexpr stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::stable_vector(stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>&& other) : m_allocator{other.m_allocator}, m_chunks{std::move(other.m_chunks)}, m_chunk_ends{std::move(other.m_chunk_ends)}, m_size{other.m_size},
+																																		m_capacity{other.m_capacity}, m_tail_chunk{other.m_tail_chunk}, m_tail_next{other.m_tail_next}, m_tail_last{other.m_tail_last}, m_retained_limit{other.m_retained_limit}
+	{
+		other.m_chunk_ends.clear();
+		other.m_size = 0;
+		other.m_capacity = 0;
+		other.m_tail_chunk = 0;
+		other.reset_tail_cursor();
 
-		template <typename T, typename Allocator>
-		constexpr detail::vector_chunk<T, Allocator>::iterator::iterator() noexcept : raw_iterator{}  {}
+		take_inline_chunk(other);
+	}
 
-		template <typename T, typename Allocator>
-		constexpr vector_chunk<T, Allocator>::iterator::iterator(raw_iterator it) noexcept : raw_iterator{it}  {}
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	constexpr stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::stable_vector(stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>&& other,
+																			 const std::type_identity_t<Allocator>& allocator) : stable_vector{uninit_tag{}, allocator}
+	{
+		move_initialize(other);
+	}
 
-		template <typename T, typename Allocator>
-		constexpr detail::vector_chunk<T, Allocator>::iterator::iterator(pointer ptr) noexcept : raw_iterator(ptr)  {}
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	constexpr stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::stable_vector(stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>&& other,
+																			 const std::type_identity_t<Allocator>& allocator,
+																			 const std::type_identity_t<ChunkAllocator>& chunk_allocator) : stable_vector{uninit_tag{}, allocator, chunk_allocator}
+	{
+		move_initialize(other);
+	}
 
-		template <typename T, typename Allocator>
-		constexpr detail::vector_chunk<T, Allocator>::iterator& detail::vector_chunk<T, Allocator>::iterator::operator++() noexcept
-		{
-			return static_cast<iterator&>(raw_iterator::operator++());
-		}
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	constexpr stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::~stable_vector()
+	{
+		destroy_elements();
+		truncate_chunks(0);
+	}
 
-		template <typename T, typename Allocator>
-		constexpr detail::vector_chunk<T, Allocator>::iterator detail::vector_chunk<T, Allocator>::iterator::operator++(int) noexcept
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	constexpr stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>& stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::operator=(stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity> other)
+	{
+		// allocators stay with their container, so contents from an unequal allocator are moved element by element
+		if (m_allocator == other.m_allocator && m_chunks.get_allocator() == other.m_chunks.get_allocator())
 		{
-			return raw_iterator::operator++(0);
+			swap(*this, other);
 		}
-
-		template <typename T, typename Allocator>
-		constexpr detail::vector_chunk<T, Allocator>::iterator& detail::vector_chunk<T, Allocator>::iterator::operator--() noexcept
+		else
 		{
-			return static_cast<iterator&>(raw_iterator::operator--());
+			destroy_elements();
+			truncate_chunks(0);
+			move_initialize(other);
 		}
+		return *this;
+	}
 
-		template <typename T, typename Allocator>
-		constexpr detail::vector_chunk<T, Allocator>::iterator detail::vector_chunk<T, Allocator>::iterator::operator--(int) noexcept
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	constexpr Allocator stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::get_allocator() const noexcept
+	{
+		return m_allocator;
+	}
+
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	template <typename... Args>
+	constexpr T& stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::emplace_back(Args&&... args)
+	{
+		if (m_tail_next == m_tail_last) [[unlikely]]
 		{
-			return raw_iterator::operator--(0);
+			return emplace_back_slow(std::forward<Args>(args)...);
 		}
 
-		template <typename T, typename Allocator>
-		constexpr bool detail::vector_chunk<T, Allocator>::iterator::operator==(iterator other) const noexcept
+		// arguments referring into this container stay valid, as no element moves when storage grows
+		std::allocator_traits<Allocator>::construct(m_allocator, m_tail_next, std::forward<Args>(args)...);
+		m_size++;
+		return *m_tail_next++;
+	}
+
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	template <typename... Args>
+	constexpr T& stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::emplace_back_slow(Args&&... args)
+	{
+		// the container is full, or the element lands in the last slot of the tail chunk
+		if (full())
 		{
-			return raw_iterator::operator==(other);
+			push_chunk(next_chunk_capacity());
 		}
 
-		template <typename T, typename Allocator>
-		constexpr bool detail::vector_chunk<T, Allocator>::iterator::operator==(const_iterator other) const noexcept
+		T* slot = m_chunks[m_tail_chunk] + (m_size - chunk_start_of(m_tail_chunk));
+		std::allocator_traits<Allocator>::construct(m_allocator, slot, std::forward<Args>(args)...);
+
+		m_size++;
+		if (m_size == chunk_end_of(m_tail_chunk))
 		{
-			return raw_iterator::operator==(other);
+			m_tail_chunk++;
 		}
+		reset_tail_cursor();
+		return *slot;
+	}
+
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	constexpr void stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::push_back(const T& val)
+	{
+		emplace_back(val);
+	}
+
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	constexpr void stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::push_back(T&& val)
+	{
+		emplace_back(std::move(val));
+	}
 
-		template <typename T, typename Allocator>
-		constexpr bool detail::vector_chunk<T, Allocator>::iterator::operator==(reverse_iterator other) const noexcept
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	constexpr void stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::pop_back()
+	{
+		if (m_tail_chunk == m_chunks.size() || chunk_start_of(m_tail_chunk) == m_size)
 		{
-			return raw_iterator::operator==(other);
+			m_tail_chunk--;
 		}
 
-		template <typename T, typename Allocator>
-		constexpr bool detail::vector_chunk<T, Allocator>::iterator::operator==(const_reverse_iterator other) const noexcept
+		m_size--;
+		std::allocator_traits<Allocator>::destroy(m_allocator, m_chunks[m_tail_chunk] + (m_size - chunk_start_of(m_tail_chunk)));
+		reset_tail_cursor();
+	}
+
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	template <typename Range>
+	constexpr void stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::append_range(Range&& range)
+	{
+		if constexpr (std::ranges::sized_range<Range> || std::ranges::forward_range<Range>)
 		{
-			return raw_iterator::operator==(other);
+			auto first = std::ranges::begin(range);
+			append_filled(static_cast<std::size_t>(std::ranges::distance(range)), [this, &first](T* dest, std::size_t, std::size_t count)
+			{
+				first = detail::uninitialized_copy_advance(m_allocator, first, count, dest);
+			});
 		}
-
-		template <typename T, typename Allocator>
-		constexpr detail::vector_chunk<T, Allocator>::iterator::reference detail::vector_chunk<T, Allocator>::iterator::operator*() noexcept
+		else
 		{
-			return raw_iterator::operator*();
+			for (auto&& elem : range)
+			{
+				emplace_back(std::forward<decltype(elem)>(elem));
+			}
 		}
+	}
 
-		template <typename T, typename Allocator>
-		constexpr detail::vector_chunk<T, Allocator>::iterator::pointer detail::vector_chunk<T, Allocator>::iterator::operator->() noexcept
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	template <typename It>
+	constexpr void stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::append(It first, It last)
+	{
+		if constexpr (std::forward_iterator<It>)
 		{
-			return raw_iterator::operator->();
+			append_filled(static_cast<std::size_t>(std::distance(first, last)), [this, &first](T* dest, std::size_t, std::size_t count)
+			{
+				first = detail::uninitialized_copy_advance(m_allocator, first, count, dest);
+			});
 		}
-
-		template <typename T, typename Allocator>
-		constexpr void swap(typename vector_chunk<T, Allocator>::iterator& a, typename vector_chunk<T, Allocator>::iterator& b) noexcept
+		else
 		{
-			swap<T, Allocator>(static_cast<vector_chunk<T, Allocator>::raw_iterator&>(a), static_cast<vector_chunk<T, Allocator>::raw_iterator&>(b));
+			for (; first != last; ++first)
+			{
+				emplace_back(*first);
+			}
 		}
+	}
+
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	constexpr void stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::append_n(std::size_t n, const T& value)
+	{
+		// value may refer to an element of this container, which stays put while storage grows
+		append_filled(n, [this, &value](T* dest, std::size_t, std::size_t count)
+		{
+			detail::uninitialized_construct_n(m_allocator, dest, count, value);
+		});
+	}
+
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	constexpr T& stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::operator[](std::size_t index) noexcept
+	{
+		return *data_at(index);
+	}
 
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	constexpr const T& stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::operator[](std::size_t index) const noexcept
+	{
+		return *data_at(index);
+	}
 
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	constexpr T& stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::at(std::size_t index)
+	{
+		if (index >= m_size)
+		{
+			throw std::out_of_range("stable_vector::at: index out of range");
+		}
+		return *data_at(index);
+	}
 
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	constexpr const T& stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::at(std::size_t index) const
+	{
+		if (index >= m_size)
+		{
+			throw std::out_of_range("stable_vector::at: index out of range");
+		}
+		return *data_at(index);
+	}
 
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	constexpr T* stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::data_at(std::size_t index) noexcept
+	{
+		assert(index < m_capacity);
 
+		std::size_t chunk_index = chunk_index_of(index);
+		return m_chunks[chunk_index] + (index - chunk_start_of(chunk_index));
+	}
 
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	constexpr const T* stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::data_at(std::size_t index) const noexcept
+	{
+		assert(index < m_capacity);
 
+		std::size_t chunk_index = chunk_index_of(index);
+		return m_chunks[chunk_index] + (index - chunk_start_of(chunk_index));
+	}
 
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	constexpr void stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::reserve(std::size_t n)
+	{
+		// one chunk covering exactly the missing capacity, so filling up to n allocates nothing more
+		if (n > m_capacity)
+		{
+			push_chunk(n - m_capacity);
+		}
+	}
 
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	constexpr void stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::reserve_extra(std::size_t n)
+	{
+		reserve(m_size + n);
+	}
 
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	constexpr std::size_t stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::capacity() const noexcept
+	{
+		return m_capacity;
+	}
 
-		template <typename T, typename Allocator>
-		constexpr detail::vector_chunk<T, Allocator>::const_iterator::const_iterator() noexcept : raw_iterator{}  {}
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	constexpr void stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::clear()
+	{
+		std::size_t kept_chunks = static_cast<std::size_t>(std::upper_bound(m_chunk_ends.begin(), m_chunk_ends.end(), m_retained_limit) - m_chunk_ends.begin());
 
-		template <typename T, typename Allocator>
-		constexpr detail::vector_chunk<T, Allocator>::const_iterator::const_iterator(pointer ptr) noexcept : raw_iterator(ptr)  {}
+		destroy_elements();
+		truncate_chunks(kept_chunks);
+	}
 
-		template <typename T, typename Allocator>
-		constexpr detail::vector_chunk<T, Allocator>::const_iterator& detail::vector_chunk<T, Allocator>::const_iterator::operator++() noexcept
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	constexpr void stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::resize(std::size_t n)
+	{
+		if (n < m_size)
 		{
-			return static_cast<const_iterator&>(raw_iterator::operator++());
+			truncate(n);
+			return;
 		}
-
-		template <typename T, typename Allocator>
-		constexpr detail::vector_chunk<T, Allocator>::const_iterator detail::vector_chunk<T, Allocator>::const_iterator::operator++(int) noexcept
+		append_filled(n - m_size, [this](T* dest, std::size_t, std::size_t count)
 		{
-			return raw_iterator::operator++(0);
-		}
+			detail::uninitialized_construct_n(m_allocator, dest, count);
+		});
+	}
 
-		template <typename T, typename Allocator>
-		constexpr detail::vector_chunk<T, Allocator>::const_iterator& detail::vector_chunk<T, Allocator>::const_iterator::operator--() noexcept
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	constexpr void stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::resize(std::size_t n, const T& value)
+	{
+		if (n < m_size)
 		{
-			return static_cast<const_iterator&>(raw_iterator::operator--());
+			truncate(n);
+			return;
 		}
+		append_n(n - m_size, value);
+	}
 
-		template <typename T, typename Allocator>
-		constexpr detail::vector_chunk<T, Allocator>::const_iterator detail::vector_chunk<T, Allocator>::const_iterator::operator--(int) noexcept
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	constexpr void stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::resize_for_overwrite(std::size_t n) requires std::is_trivially_default_constructible_v<T>
+	{
+		if (n < m_size)
 		{
-			return raw_iterator::operator--(0);
+			truncate(n);
+			return;
 		}
-
-		template <typename T, typename Allocator>
-		constexpr bool detail::vector_chunk<T, Allocator>::const_iterator::operator==(iterator other) const noexcept
+		append_filled(n - m_size, [this](T* dest, std::size_t, std::size_t count)
 		{
-			return raw_iterator::operator==(other);
-		}
+			detail::uninitialized_default_construct_n(m_allocator, dest, count);
+		});
+	}
 
-		template <typename T, typename Allocator>
-		constexpr bool detail::vector_chunk<T, Allocator>::const_iterator::operator==(const_iterator other) const noexcept
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	constexpr void stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::truncate(std::size_t n)
+	{
+		if (n >= m_size)
 		{
-			return raw_iterator::operator==(other);
+			return;
 		}
+		destroy_elements(n);
 
-		template <typename T, typename Allocator>
-		constexpr bool detail::vector_chunk<T, Allocator>::const_iterator::operator==(reverse_iterator other) const noexcept
-		{
-			return raw_iterator::operator==(other);
-		}
+		std::size_t needed_chunks = n == 0 ? 0 : chunk_index_of(n - 1) + 1;
+		std::size_t retained_chunks = static_cast<std::size_t>(std::upper_bound(m_chunk_ends.begin(), m_chunk_ends.end(), m_retained_limit) - m_chunk_ends.begin());
+		truncate_chunks(std::max(needed_chunks, retained_chunks));
+	}
 
-		template <typename T, typename Allocator>
-		constexpr bool detail::vector_chunk<T, Allocator>::const_iterator::operator==(const_reverse_iterator other) const noexcept
-		{
-			return raw_iterator::operator==(other);
-		}
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	constexpr void stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::retain_capacity(std::size_t limit) noexcept
+	{
+		m_retained_limit = limit;
+	}
 
-		template <typename T, typename Allocator>
-		constexpr detail::vector_chunk<T, Allocator>::const_iterator::reference detail::vector_chunk<T, Allocator>::const_iterator::operator*() noexcept
-		{
-			return raw_iterator::operator*();
-		}
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	constexpr std::size_t stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::retained_capacity_limit() const noexcept
+	{
+		return m_retained_limit;
+	}
 
-		template <typename T, typename Allocator>
-		constexpr detail::vector_chunk<T, Allocator>::const_iterator::pointer detail::vector_chunk<T, Allocator>::const_iterator::operator->() noexcept
-		{
-			return raw_iterator::operator->();
-		}
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	constexpr void stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::release_unused()
+	{
+		truncate_chunks(m_size == 0 ? 0 : chunk_index_of(m_size - 1) + 1);
+	}
+
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	constexpr std::size_t stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::chunk_count() const noexcept
+	{
+		return m_chunks.size();
+	}
+
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	constexpr std::size_t stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::bytes_allocated() const noexcept
+	{
+		return (m_capacity - inline_chunk_capacity()) * sizeof(T);
+	}
 
-		template <typename T, typename Allocator>
-		constexpr void swap(typename vector_chunk<T, Allocator>::const_iterator& a, typename vector_chunk<T, Allocator>::const_iterator& b) noexcept
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	constexpr std::size_t stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::bytes_metadata() const noexcept
+	{
+		return m_chunks.capacity() * sizeof(T*) + m_chunk_ends.capacity() * sizeof(std::size_t);
+	}
+
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	constexpr std::size_t stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::bytes_slack() const noexcept
+	{
+		// an inline first chunk fills up before any allocated chunk, so every allocated slot past m_size is slack
+		std::size_t allocated_in_use = m_size - std::min(m_size, inline_chunk_capacity());
+		return bytes_allocated() - allocated_in_use * sizeof(T);
+	}
+
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	constexpr stable_vector_memory_stats stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::memory_stats() const
+	{
+		stable_vector_memory_stats stats{m_size, m_capacity, chunk_count(), bytes_allocated(), bytes_metadata(), bytes_slack(), {}};
+		stats.chunks.reserve(m_chunks.size());
+		for (std::size_t chunk_index = 0; chunk_index < m_chunks.size(); chunk_index++)
 		{
-			swap(static_cast<vector_chunk<T, Allocator>::raw_iterator&>(a), static_cast<vector_chunk<T, Allocator>::raw_iterator&>(b));
+			stats.chunks.push_back({chunk_start_of(chunk_index), chunk_end_of(chunk_index) - chunk_start_of(chunk_index), chunk_span(chunk_index).size(),
+									chunk_index == 0 && inline_chunk_capacity() != 0});
 		}
+		return stats;
+	}
 
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	constexpr bool stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::empty() const noexcept
+	{
+		return m_size == 0;
+	}
+
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	constexpr std::size_t stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::size() const noexcept
+	{
+		return m_size;
+	}
 
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	constexpr stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::iterator stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::begin() noexcept
+	{
+		return iterator{raw_begin()};
+	}
 
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	constexpr stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::iterator stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::end() noexcept
+	{
+		return iterator{raw_end()};
+	}
 
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	constexpr stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::const_iterator stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::cbegin() const noexcept
+	{
+		return const_iterator{raw_begin()};
+	}
 
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	constexpr stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::const_iterator stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::cend() const noexcept
+	{
+		return const_iterator{raw_end()};
+	}
 
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	constexpr stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::reverse_iterator stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::rbegin() noexcept
+	{
+		return reverse_iterator{raw_before_end()};
+	}
 
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	constexpr stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::reverse_iterator stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::rend() noexcept
+	{
+		return reverse_iterator{raw_before_begin()};
+	}
 
-		template <typename T, typename Allocator>
-		constexpr detail::vector_chunk<T, Allocator>::reverse_iterator::reverse_iterator() noexcept : raw_iterator{}  {}
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	constexpr stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::const_reverse_iterator stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::crbegin() const noexcept
+	{
+		return const_reverse_iterator{raw_before_end()};
+	}
 
-		template <typename T, typename Allocator>
-		constexpr detail::vector_chunk<T, Allocator>::reverse_iterator::reverse_iterator(pointer ptr) noexcept : raw_iterator(ptr)  {}
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	constexpr stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::const_reverse_iterator stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::crend() const noexcept
+	{
+		return const_reverse_iterator{raw_before_begin()};
+	}
 
-		template <typename T, typename Allocator>
-		constexpr detail::vector_chunk<T, Allocator>::reverse_iterator& detail::vector_chunk<T, Allocator>::reverse_iterator::operator++() noexcept
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	constexpr auto stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::segments() noexcept
+	{
+		return std::views::iota(std::size_t{0}, segment_count()) | std::views::transform([this](std::size_t chunk_index)
 		{
-			return static_cast<reverse_iterator&>(raw_iterator::operator--());
-		}
+			return chunk_span(chunk_index);
+		});
+	}
 
-		template <typename T, typename Allocator>
-		constexpr detail::vector_chunk<T, Allocator>::reverse_iterator detail::vector_chunk<T, Allocator>::reverse_iterator::operator++(int) noexcept
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	constexpr auto stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::segments() const noexcept
+	{
+		return std::views::iota(std::size_t{0}, segment_count()) | std::views::transform([this](std::size_t chunk_index)
 		{
-			return raw_iterator::operator--(0);
-		}
+			return std::span<const T>{chunk_span(chunk_index)};
+		});
+	}
 
-		template <typename T, typename Allocator>
-		constexpr detail::vector_chunk<T, Allocator>::reverse_iterator& detail::vector_chunk<T, Allocator>::reverse_iterator::operator--() noexcept
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	template <typename Fn>
+	constexpr void stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::for_each_segment(Fn fn)
+	{
+		for (std::size_t chunk_index = 0, count = segment_count(); chunk_index < count; chunk_index++)
 		{
-			return static_cast<reverse_iterator&>(raw_iterator::operator++());
+			std::span<T> current_chunk = chunk_span(chunk_index);
+			fn(current_chunk);
 		}
+	}
 
-		template <typename T, typename Allocator>
-		constexpr detail::vector_chunk<T, Allocator>::reverse_iterator detail::vector_chunk<T, Allocator>::reverse_iterator::operator--(int) noexcept
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	template <typename Fn>
+	constexpr void stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::for_each_segment(Fn fn) const
+	{
+		for (std::size_t chunk_index = 0, count = segment_count(); chunk_index < count; chunk_index++)
 		{
-			return raw_iterator::operator++(0);
+			std::span<const T> current_chunk = chunk_span(chunk_index);
+			fn(current_chunk);
 		}
+	}
 
-		template <typename T, typename Allocator>
-		constexpr bool detail::vector_chunk<T, Allocator>::reverse_iterator::operator==(iterator other) const noexcept
-		{
-			return raw_iterator::operator==(other);
-		}
-		
-		template <typename T, typename Allocator>
-		constexpr bool detail::vector_chunk<T, Allocator>::reverse_iterator::operator==(const_iterator other) const noexcept
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	T stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::sum() const requires detail::simd::element<T>
+	{
+		T total{};
+		for (std::size_t chunk_index = 0, count = segment_count(); chunk_index < count; chunk_index++)
 		{
-			return raw_iterator::operator==(other);
+			std::span<const T> current_chunk = chunk_span(chunk_index);
+			total += detail::simd::dispatch<detail::simd::sum_kernel>(static_cast<const T*>(current_chunk.data()), current_chunk.size());
 		}
+		return total;
+	}
 
-		template <typename T, typename Allocator>
-		constexpr bool detail::vector_chunk<T, Allocator>::reverse_iterator::operator==(reverse_iterator other) const noexcept
-		{
-			return raw_iterator::operator==(other);
-		}
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	T stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::min() const requires detail::simd::element<T>
+	{
+		assert(!empty());
 
-		template <typename T, typename Allocator>
-		constexpr bool detail::vector_chunk<T, Allocator>::reverse_iterator::operator==(const_reverse_iterator other) const noexcept
+		T result = m_chunks[0][0];
+		for (std::size_t chunk_index = 0, count = segment_count(); chunk_index < count; chunk_index++)
 		{
-			return raw_iterator::operator==(other);
+			std::span<const T> current_chunk = chunk_span(chunk_index);
+			T chunk_min = detail::simd::dispatch<detail::simd::min_kernel>(static_cast<const T*>(current_chunk.data()), current_chunk.size());
+			result = chunk_min < result ? chunk_min : result;
 		}
+		return result;
+	}
+
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	T stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::max() const requires detail::simd::element<T>
+	{
+		assert(!empty());
 
-		template <typename T, typename Allocator>
-		constexpr detail::vector_chunk<T, Allocator>::reverse_iterator::reference detail::vector_chunk<T, Allocator>::reverse_iterator::operator*() noexcept
+		T result = m_chunks[0][0];
+		for (std::size_t chunk_index = 0, count = segment_count(); chunk_index < count; chunk_index++)
 		{
-			return raw_iterator::operator*();
+			std::span<const T> current_chunk = chunk_span(chunk_index);
+			T chunk_max = detail::simd::dispatch<detail::simd::max_kernel>(static_cast<const T*>(current_chunk.data()), current_chunk.size());
+			result = result < chunk_max ? chunk_max : result;
 		}
+		return result;
+	}
 
-		template <typename T, typename Allocator>
-		constexpr detail::vector_chunk<T, Allocator>::reverse_iterator::pointer detail::vector_chunk<T, Allocator>::reverse_iterator::operator->() noexcept
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	std::pair<T, T> stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::minmax() const requires detail::simd::element<T>
+	{
+		assert(!empty());
+
+		std::pair<T, T> result{m_chunks[0][0], m_chunks[0][0]};
+		for (std::size_t chunk_index = 0, count = segment_count(); chunk_index < count; chunk_index++)
 		{
-			return raw_iterator::operator->();
+			std::span<const T> current_chunk = chunk_span(chunk_index);
+			auto [chunk_min, chunk_max] = detail::simd::dispatch<detail::simd::minmax_kernel>(static_cast<const T*>(current_chunk.data()), current_chunk.size());
+			result.first = chunk_min < result.first ? chunk_min : result.first;
+			result.second = result.second < chunk_max ? chunk_max : result.second;
 		}
+		return result;
+	}
 
-		template <typename T, typename Allocator>
-		constexpr void swap(typename vector_chunk<T, Allocator>::reverse_iterator& a, typename vector_chunk<T, Allocator>::reverse_iterator& b) noexcept
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	std::size_t stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::count(T value) const requires detail::simd::element<T>
+	{
+		std::size_t total = 0;
+		for (std::size_t chunk_index = 0, count = segment_count(); chunk_index < count; chunk_index++)
 		{
-			swap(static_cast<vector_chunk<T, Allocator>::raw_iterator&>(a), static_cast<vector_chunk<T, Allocator>::raw_iterator&>(b));
+			std::span<const T> current_chunk = chunk_span(chunk_index);
+			total += detail::simd::dispatch<detail::simd::count_kernel>(static_cast<const T*>(current_chunk.data()), current_chunk.size(), value);
 		}
+		return total;
+	}
 
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::iterator stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::find(T value) requires detail::simd::element<T>
+	{
+		return raw_iterator{this, find_index(value)};
+	}
 
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::const_iterator stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::find(T value) const requires detail::simd::element<T>
+	{
+		return raw_iterator{this, find_index(value)};
+	}
 
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	std::size_t stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::find_index(T value) const requires detail::simd::element<T>
+	{
+		for (std::size_t chunk_index = 0, count = segment_count(); chunk_index < count; chunk_index++)
+		{
+			std::span<const T> current_chunk = chunk_span(chunk_index);
+			std::size_t offset = detail::simd::dispatch<detail::simd::find_kernel>(static_cast<const T*>(current_chunk.data()), current_chunk.size(), value);
+			if (offset < current_chunk.size())
+			{
+				return chunk_start_of(chunk_index) + offset;
+			}
+		}
+		return m_size;
+	}
 
 
 
 
 
 
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	constexpr std::size_t stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::raw_iterator::index() const noexcept
+	{
+		if (m_ptr == nullptr)
+		{
+			// either before-begin or the only position of a container without chunks
+			return m_chunk_index == before_begin_chunk ? static_cast<std::size_t>(-1) : 0;
+		}
+		return m_vector->chunk_start_of(m_chunk_index) + static_cast<std::size_t>(m_ptr - m_chunk_begin);
+	}
 
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	constexpr void stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::raw_iterator::enter_chunk(std::size_t chunk_index) noexcept
+	{
+		m_chunk_index = chunk_index;
 
-		template <typename T, typename Allocator>
-		constexpr detail::vector_chunk<T, Allocator>::const_reverse_iterator::const_reverse_iterator() noexcept : raw_iterator{}  {}
+		if (chunk_index < m_vector->m_chunks.size())
+		{
+			m_chunk_begin = m_vector->m_chunks[chunk_index];
+			m_chunk_last = m_chunk_begin + (m_vector->chunk_end_of(chunk_index) - m_vector->chunk_start_of(chunk_index) - 1);
+		}
+		else
+		{
+			m_chunk_begin = nullptr;
+			m_chunk_last = nullptr;
+		}
+	}
 
-		template <typename T, typename Allocator>
-		constexpr detail::vector_chunk<T, Allocator>::const_reverse_iterator::const_reverse_iterator(pointer ptr) noexcept : raw_iterator(ptr)  {}
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	constexpr void stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::raw_iterator::locate(std::size_t index) noexcept
+	{
+		std::size_t chunk_index = m_vector->chunk_index_of(index);
 
-		template <typename T, typename Allocator>
-		constexpr detail::vector_chunk<T, Allocator>::const_reverse_iterator& detail::vector_chunk<T, Allocator>::const_reverse_iterator::operator++() noexcept
+		if (index == static_cast<std::size_t>(-1))
 		{
-			return static_cast<const_reverse_iterator&>(raw_iterator::operator--());
+			enter_chunk(before_begin_chunk);
+			m_ptr = nullptr;
 		}
-
-		template <typename T, typename Allocator>
-		constexpr detail::vector_chunk<T, Allocator>::const_reverse_iterator detail::vector_chunk<T, Allocator>::const_reverse_iterator::operator++(int) noexcept
+		else if (chunk_index < m_vector->m_chunks.size())
 		{
-			return raw_iterator::operator--(0);
+			enter_chunk(chunk_index);
+			m_ptr = m_chunk_begin + (index - m_vector->chunk_start_of(chunk_index));
 		}
-
-		template <typename T, typename Allocator>
-		constexpr detail::vector_chunk<T, Allocator>::const_reverse_iterator& detail::vector_chunk<T, Allocator>::const_reverse_iterator::operator--() noexcept
+		else if (chunk_index > 0 && chunk_index == m_vector->m_chunks.size())
 		{
-			return static_cast<const_reverse_iterator&>(raw_iterator::operator++());
+			// the end of a full container is one past the last slot of the last chunk, which is where increment() lands
+			enter_chunk(chunk_index - 1);
+			m_ptr = m_chunk_last + 1;
 		}
-
-		template <typename T, typename Allocator>
-		constexpr detail::vector_chunk<T, Allocator>::const_reverse_iterator detail::vector_chunk<T, Allocator>::const_reverse_iterator::operator--(int) noexcept
+		else
 		{
-			return raw_iterator::operator++(0);
+			enter_chunk(chunk_index);
+			m_ptr = nullptr;
 		}
+	}
 
-		template <typename T, typename Allocator>
-		constexpr bool detail::vector_chunk<T, Allocator>::const_reverse_iterator::operator==(iterator other) const noexcept
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	constexpr void stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::raw_iterator::increment() noexcept
+	{
+		if (m_ptr != m_chunk_last)
 		{
-			return raw_iterator::operator==(other);
+			m_ptr++;
 		}
-
-		template <typename T, typename Allocator>
-		constexpr bool detail::vector_chunk<T, Allocator>::const_reverse_iterator::operator==(const_iterator other) const noexcept
+		else if (m_chunk_index + 1 < m_vector->m_chunks.size())
 		{
-			return raw_iterator::operator==(other);
+			// also moves before-begin onto the first chunk, as its index wraps around to 0
+			enter_chunk(m_chunk_index + 1);
+			m_ptr = m_chunk_begin;
 		}
-
-		template <typename T, typename Allocator>
-		constexpr bool detail::vector_chunk<T, Allocator>::const_reverse_iterator::operator==(reverse_iterator other) const noexcept
+		else if (m_ptr != nullptr)
 		{
-			return raw_iterator::operator==(other);
+			m_ptr++;
 		}
-
-		template <typename T, typename Allocator>
-		constexpr bool detail::vector_chunk<T, Allocator>::const_reverse_iterator::operator==(const_reverse_iterator other) const noexcept
+		else
 		{
-			return raw_iterator::operator==(other);
+			m_chunk_index++;
 		}
+	}
 
-		template <typename T, typename Allocator>
-		constexpr detail::vector_chunk<T, Allocator>::const_reverse_iterator::reference detail::vector_chunk<T, Allocator>::const_reverse_iterator::operator*() noexcept
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	constexpr void stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::raw_iterator::decrement() noexcept
+	{
+		if (m_ptr != m_chunk_begin)
 		{
-			return raw_iterator::operator*();
+			m_ptr--;
 		}
-
-		template <typename T, typename Allocator>
-		constexpr detail::vector_chunk<T, Allocator>::const_reverse_iterator::pointer detail::vector_chunk<T, Allocator>::const_reverse_iterator::operator->() noexcept
+		else if (m_chunk_index > 0 && m_chunk_index != before_begin_chunk)
 		{
-			return raw_iterator::operator->();
+			enter_chunk(m_chunk_index - 1);
+			m_ptr = m_chunk_last;
 		}
-
-		template <typename T, typename Allocator>
-		constexpr void swap(typename vector_chunk<T, Allocator>::const_reverse_iterator& a, typename vector_chunk<T, Allocator>::const_reverse_iterator& b) noexcept
+		else
 		{
-			swap(static_cast<vector_chunk<T, Allocator>::raw_iterator&>(a), static_cast<vector_chunk<T, Allocator>::raw_iterator&>(b));
+			enter_chunk(before_begin_chunk);
+			m_ptr = nullptr;
 		}
 	}
 
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	template <typename Pointer, typename Fn>
+	constexpr bool stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::raw_iterator::walk_segments(raw_iterator last, Fn& fn) const
+	{
+		std::size_t index = this->index();
+		std::size_t last_index = last.index();
+		if (index >= last_index)
+		{
+			return true;
+		}
 
+		for (std::size_t chunk_index = m_vector->chunk_index_of(index); index < last_index; chunk_index++)
+		{
+			std::size_t chunk_start = m_vector->chunk_start_of(chunk_index);
+			std::size_t segment_end = std::min(m_vector->chunk_end_of(chunk_index), last_index);
+			Pointer chunk_data = m_vector->m_chunks[chunk_index];
 
+			if (!fn(chunk_data + (index - chunk_start), chunk_data + (segment_end - chunk_start)))
+			{
+				return false;
+			}
+			index = segment_end;
+		}
+		return true;
+	}
 
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	template <typename Pointer, typename Fn>
+	constexpr bool stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::raw_iterator::walk_segments_reverse(raw_iterator last, Fn& fn) const
+	{
+		// work with one-past positions so that before-begin wraps around to 0
+		std::size_t index = this->index() + 1;
+		std::size_t segment_limit = last.index() + 1;
+		if (index <= segment_limit)
+		{
+			return true;
+		}
 
+		for (std::size_t chunk_index = m_vector->chunk_index_of(index - 1); index > segment_limit; chunk_index--)
+		{
+			std::size_t chunk_start = m_vector->chunk_start_of(chunk_index);
+			std::size_t segment_start = std::max(chunk_start, segment_limit);
+			Pointer chunk_data = m_vector->m_chunks[chunk_index];
 
-	
-
-	
-
-
-
+			if (!fn(std::reverse_iterator{chunk_data + (index - chunk_start)}, std::reverse_iterator{chunk_data + (segment_start - chunk_start)}))
+			{
+				return false;
+			}
+			index = segment_start;
+		}
+		return true;
+	}
 
-	template <typename T, typename Allocator, typename ChunkAllocator> 
-	constexpr void swap(stable_vector<T, Allocator, ChunkAllocator>& a, stable_vector<T, Allocator, ChunkAllocator>& b) noexcept
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	constexpr stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::raw_iterator stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::raw_begin() const noexcept
 	{
-		std::swap(a.m_chunks, b.m_chunks);
-		std::swap(a.m_size, b.m_size);
-		std::swap(a.m_capacity, b.m_capacity);
-		swap<T, Allocator, ChunkAllocator>(a.m_end, b.m_end);
+		return raw_iterator{this, 0};
 	}
 
-	template <typename T, typename Allocator, typename ChunkAllocator>
-	constexpr stable_vector<T, Allocator, ChunkAllocator>::stable_vector(uninit_tag) : m_allocator{}, m_chunks{}, m_size{0}, m_capacity{0}, m_end{}  {}
-
-	template <typename T, typename Allocator, typename ChunkAllocator>
-	constexpr stable_vector<T, Allocator, ChunkAllocator>::stable_vector(uninit_tag, const Allocator& allocator) : m_allocator{allocator}, m_chunks{}, m_size{0}, m_capacity{0}, m_end{}  {}
-
-	template <typename T, typename Allocator, typename ChunkAllocator>
-	constexpr stable_vector<T, Allocator, ChunkAllocator>::stable_vector(uninit_tag, const Allocator& allocator,
-																			 const ChunkAllocator& chunk_allocator) : m_allocator{allocator}, m_chunks{chunk_allocator}, m_size{0}, m_capacity{0}, m_end{}  {}
-
-	template <typename T, typename Allocator, typename ChunkAllocator>
-	constexpr void stable_vector<T, Allocator, ChunkAllocator>::init_empty_chunks()
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	constexpr stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::raw_iterator stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::raw_end() const noexcept
 	{
-		push_empty_chunk();
-		push_empty_chunk();
-
-		list_iterator last_chunk_it = std::prev(m_chunks.end());
-		chunk& last_chunk = *last_chunk_it;
-		m_end = iterator{last_chunk_it, last_chunk.begin()};
+		return raw_iterator{this, m_size};
 	}
 
-	template <typename T, typename Allocator, typename ChunkAllocator>
-	constexpr void stable_vector<T, Allocator, ChunkAllocator>::copy_initialize(const stable_vector<T, Allocator, ChunkAllocator>& other)
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	constexpr stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::raw_iterator stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::raw_before_end() const noexcept
 	{
-		init_empty_chunks();
-
-		chunk new_chunk{other.size(), typename chunk::capacity_tag{}};
-		std::uninitialized_copy(other.cbegin(), other.cend(), new_chunk.begin());
-		new_chunk.m_size = other.size();
-		new_chunk.update_deleter_size();
-		m_chunks.emplace(std::prev(m_chunks.end()), std::move(new_chunk));
+		// wraps around to the same position as raw_before_begin() when empty
+		return raw_iterator{this, m_size - 1};
+	}
 
-		m_size = other.size();
-		m_capacity = other.size();
-		m_end = iterator{std::prev(m_chunks.end()), m_chunks.back().begin()};
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	constexpr stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::raw_iterator stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::raw_before_begin() const noexcept
+	{
+		return raw_iterator{this, static_cast<std::size_t>(-1)};
 	}
 
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	constexpr stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::raw_iterator::raw_iterator() noexcept : m_vector{nullptr}, m_chunk_index{0}, m_ptr{nullptr}, m_chunk_begin{nullptr}, m_chunk_last{nullptr}  {}
 
-	template <typename T, typename Allocator, typename ChunkAllocator>
-	constexpr bool stable_vector<T, Allocator, ChunkAllocator>::chunks_full() const noexcept
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	constexpr stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::raw_iterator::raw_iterator(const stable_vector* vector, std::size_t index) noexcept : m_vector{vector}, m_chunk_index{0}, m_ptr{nullptr}, m_chunk_begin{nullptr}, m_chunk_last{nullptr}
 	{
-		return m_chunks.back().full();
+		locate(index);
 	}
 
-	template <typename T, typename Allocator, typename ChunkAllocator>
-	constexpr bool stable_vector<T, Allocator, ChunkAllocator>::current_chunk_empty() const noexcept
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	constexpr stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::raw_iterator& stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::raw_iterator::operator++() noexcept
 	{
-		chunk& last_chunk = *(m_end.get_list_iterator());
-		return last_chunk.empty();
+		increment();
+		return *this;
 	}
 
-	template <typename T, typename Allocator, typename ChunkAllocator>
-	constexpr bool stable_vector<T, Allocator, ChunkAllocator>::current_chunk_full() const noexcept
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	constexpr stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::raw_iterator stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::raw_iterator::operator++(int) noexcept
 	{
-		chunk& last_chunk = *(m_end.get_list_iterator());
-		return last_chunk.full();
+		raw_iterator prev_it = *this;
+		increment();
+		return prev_it;
 	}
 
-	template <typename T, typename Allocator, typename ChunkAllocator>
-	constexpr bool stable_vector<T, Allocator, ChunkAllocator>::end_at_chunk_start() const noexcept
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	constexpr stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::raw_iterator& stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::raw_iterator::operator--() noexcept
 	{
-		chunk& current_chunk = *(m_end.get_list_iterator());
-		return current_chunk.begin() == m_end.get_chunk_iterator();
+		decrement();
+		return *this;
 	}
 
-	template <typename T, typename Allocator, typename ChunkAllocator>
-	constexpr bool stable_vector<T, Allocator, ChunkAllocator>::current_chunk_has_capacity() const noexcept
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	constexpr stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::raw_iterator stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::raw_iterator::operator--(int) noexcept
 	{
-		chunk& current_chunk = *(m_end.get_list_iterator());
-		return current_chunk.has_capacity();
+		raw_iterator prev_it = *this;
+		decrement();
+		return prev_it;
 	}
 
-	template <typename T, typename Allocator, typename ChunkAllocator>
-	constexpr void stable_vector<T, Allocator, ChunkAllocator>::push_chunk(std::size_t n)
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	constexpr stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::raw_iterator& stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::raw_iterator::operator+=(difference_type n) noexcept
 	{
-		m_chunks.emplace_back(n, typename chunk::capacity_tag{});
-
-		m_capacity += n;
+		locate(index() + n);
+		return *this;
 	}
 
-	template <typename T, typename Allocator, typename ChunkAllocator>
-	constexpr void stable_vector<T, Allocator, ChunkAllocator>::push_empty_chunk()
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	constexpr stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::raw_iterator& stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::raw_iterator::operator-=(difference_type n) noexcept
 	{
-		m_chunks.emplace_back();
+		locate(index() - n);
+		return *this;
 	}
 
-	template <typename T, typename Allocator, typename ChunkAllocator>
-	constexpr bool stable_vector<T, Allocator, ChunkAllocator>::has_capacity() const noexcept
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	constexpr stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::raw_iterator::difference_type stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::raw_iterator::operator-(raw_iterator other) const noexcept
 	{
-		return m_capacity != 0;
+		return static_cast<difference_type>(index() - other.index());
 	}
 
-	template <typename T, typename Allocator, typename ChunkAllocator>
-	constexpr bool stable_vector<T, Allocator, ChunkAllocator>::one_away_from_full() const noexcept
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	constexpr bool stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::raw_iterator::operator==(raw_iterator other) const noexcept
 	{
-		return m_capacity == (m_size + 1);
+		// positions are normalized the same way by locate() and by stepping, so chunk and pointer identify them; the pointer
+		// alone does not, as the end of a full container is one past its last chunk, which may be where another chunk starts
+		return m_ptr == other.m_ptr && m_chunk_index == other.m_chunk_index;
 	}
 
-	template <typename T, typename Allocator, typename ChunkAllocator>
-	constexpr stable_vector<T, Allocator, ChunkAllocator>::stable_vector() : stable_vector{uninit_tag{}}
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	constexpr bool stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::raw_iterator::operator==(iterator other) const noexcept
 	{
-		init_empty_chunks();
+		return operator==(static_cast<raw_iterator>(other));
 	}
 
-	template <typename T, typename Allocator, typename ChunkAllocator>
-	constexpr stable_vector<T, Allocator, ChunkAllocator>::stable_vector(const Allocator& allocator) : stable_vector{uninit_tag{}, allocator}
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	constexpr bool stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::raw_iterator::operator==(const_iterator other) const noexcept
 	{
-		init_empty_chunks();
-	}
-
-	template <typename T, typename Allocator, typename ChunkAllocator>
-	constexpr stable_vector<T, Allocator, ChunkAllocator>::stable_vector(const Allocator& allocator, const ChunkAllocator& chunk_allocator) : stable_vector{uninit_tag{}, allocator, chunk_allocator}
-	{
-		init_empty_chunks();
+		return operator==(static_cast<raw_iterator>(other));
 	}
 
-	template <typename T, typename Allocator, typename ChunkAllocator>
-	constexpr stable_vector<T, Allocator, ChunkAllocator>::stable_vector(std::size_t n, const Allocator& allocator, const ChunkAllocator& chunk_allocator) : stable_vector{uninit_tag{}, allocator, chunk_allocator}
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	constexpr bool stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::raw_iterator::operator==(reverse_iterator other) const noexcept
 	{
-		init_empty_chunks();
-
-		m_chunks.emplace(std::prev(m_chunks.end()), n, typename chunk::size_tag{});
-
-		m_size = n;
-		m_capacity = n;
-		m_end = iterator{std::prev(m_chunks.end()), m_chunks.back().begin()};
+		return operator==(static_cast<raw_iterator>(other));
 	}
 
-	template <typename T, typename Allocator, typename ChunkAllocator>
-	template <typename It>
-	constexpr stable_vector<T, Allocator, ChunkAllocator>::stable_vector(It first, It last, const Allocator& allocator, const ChunkAllocator& chunk_allocator) : stable_vector{uninit_tag{}}
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	constexpr bool stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::raw_iterator::operator==(const_reverse_iterator other) const noexcept
 	{
-		init_empty_chunks();
-
-		std::size_t size = std::distance(first, last);
-		m_chunks.emplace(std::prev(m_chunks.end()), first, last);
-		
-		m_size = size;
-		m_capacity = size;
-		m_end = iterator{std::prev(m_chunks.end()), m_chunks.back().begin()};
+		return operator==(static_cast<raw_iterator>(other));
 	}
 
-	template <typename T, typename Allocator, typename ChunkAllocator>
-	constexpr stable_vector<T, Allocator, ChunkAllocator>::stable_vector(std::initializer_list<T> init_list, const Allocator& allocator,
-																			 const ChunkAllocator& chunk_allocator) : stable_vector{init_list.begin(), init_list.end(), allocator, chunk_allocator}  {}
-	
-	template <typename T, typename Allocator, typename ChunkAllocator>
-	template <typename Begin, typename Sent>
-	constexpr stable_vector<T, Allocator, ChunkAllocator>::stable_vector(std::from_range_t, Begin first, Sent last,
-																			 const Allocator& allocator, const ChunkAllocator& chunk_allocator) : stable_vector{uninit_tag{}, allocator, chunk_allocator}
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	constexpr std::strong_ordering stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::raw_iterator::operator<=>(raw_iterator other) const noexcept
 	{
-		init_empty_chunks();
-
-		std::size_t size = std::ranges::distance(first, last);
-		m_chunks.emplace(std::prev(m_chunks.end()), std::from_range_t{}, first, last);
-
-		m_size = size;
-		m_capacity = size;
-		m_end = iterator{std::prev(m_chunks.end()), m_chunks.back().begin()};
+		// before-begin is stored as the largest index, so compare as signed positions
+		return static_cast<difference_type>(index()) <=> static_cast<difference_type>(other.index());
 	}
 
-	template <typename T, typename Allocator, typename ChunkAllocator>
-	template <typename Range>
-	constexpr stable_vector<T, Allocator, ChunkAllocator>::stable_vector(std::from_range_t, Range&& range, const Allocator& allocator,
-																			 const ChunkAllocator& chunk_allocator) : stable_vector{std::from_range_t{}, std::ranges::begin(range),
-																			 														   std::ranges::end(range), allocator, chunk_allocator}  {}
-
-	template <typename T, typename Allocator, typename ChunkAllocator>
-	constexpr stable_vector<T, Allocator, ChunkAllocator>::stable_vector(const stable_vector<T, Allocator, ChunkAllocator>& other) : stable_vector{uninit_tag{}}
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	constexpr stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::raw_iterator::reference stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::raw_iterator::operator*() const noexcept
 	{
-		copy_initialize(other);
+		return *m_ptr;
 	}
 
-	template <typename T, typename Allocator, typename ChunkAllocator>
-	constexpr stable_vector<T, Allocator, ChunkAllocator>::stable_vector(const stable_vector<T, Allocator, ChunkAllocator>& other, const std::type_identity<Allocator>& allocator) : stable_vector{uninit_tag{}, allocator}
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	constexpr stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::raw_iterator::pointer stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::raw_iterator::operator->() const noexcept
 	{
-		copy_initialize(other);
+		return m_ptr;
 	}
 
-	template <typename T, typename Allocator, typename ChunkAllocator>
-	constexpr stable_vector<T, Allocator, ChunkAllocator>::stable_vector(const stable_vector<T, Allocator, ChunkAllocator>& other, const std::type_identity<Allocator>& allocator,
-																			 const std::type_identity<ChunkAllocator>& chunk_allocator) : stable_vector{uninit_tag{}, allocator, chunk_allocator}
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	constexpr void swap(typename stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::raw_iterator& a, typename stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::raw_iterator& b) noexcept
 	{
-		copy_initialize(other);
+		std::swap(a.m_vector, b.m_vector);
+		std::swap(a.m_chunk_index, b.m_chunk_index);
+		std::swap(a.m_ptr, b.m_ptr);
+		std::swap(a.m_chunk_begin, b.m_chunk_begin);
+		std::swap(a.m_chunk_last, b.m_chunk_last);
 	}
 
-	template <typename T, typename Allocator, typename ChunkAllocator>
-	constexpr stable_vector<T, Allocator, ChunkAllocator>::stable_vector(stable_vector<T, Allocator, ChunkAllocator>&& other) : m_allocator{}, m_chunks{std::move(other.m_chunks), ChunkAllocator{}}, m_size{other.m_size},
-																																		m_capacity{other.m_capacity}, m_end{other.m_end}
-	{
-		other.m_size = 0;
-		other.m_capacity = 0;
-		other.m_end = iterator{};
-	}
 
-	template <typename T, typename Allocator, typename ChunkAllocator>
-	constexpr stable_vector<T, Allocator, ChunkAllocator>::stable_vector(stable_vector<T, Allocator, ChunkAllocator>&& other,
-																			 const std::type_identity<Allocator>& allocator) : m_allocator{allocator}, m_chunks{std::move(other.m_chunks), ChunkAllocator{}}, m_size{other.m_size},
-																															   m_capacity{other.m_capacity}, m_end{other.m_end}
-	{
-		other.m_size = 0;
-		other.m_capacity = 0;
-		other.m_end = iterator{};
-	}
 
-	template <typename T, typename Allocator, typename ChunkAllocator>
-	constexpr stable_vector<T, Allocator, ChunkAllocator>::stable_vector(stable_vector<T, Allocator, ChunkAllocator>&& other,
-																			 const std::type_identity<Allocator>& allocator,
-																			 const std::type_identity<ChunkAllocator>& chunk_allocator) : m_allocator{allocator}, m_chunks{std::move(other.m_chunks), chunk_allocator}, m_size{other.m_size},
-																																			  m_capacity{other.m_capacity}, m_end{other.m_end}
-	{
-		other.m_size = 0;
-		other.m_capacity = 0;
-		other.m_end = iterator{};
-	}
 
-	template <typename T, typename Allocator, typename ChunkAllocator>
-	constexpr stable_vector<T, Allocator, ChunkAllocator>& stable_vector<T, Allocator, ChunkAllocator>::operator=(stable_vector<T, Allocator, ChunkAllocator> other)
-	{
-		swap(*this, other);
-		return *this;
-	}
 
-	template <typename T, typename Allocator, typename ChunkAllocator>
-	template <typename... Args>
-	constexpr void stable_vector<T, Allocator, ChunkAllocator>::emplace_back(Args&&... args)
-	{
-		T new_elem = T(std::forward<Args>(args)...);
 
-		chunk& last_chunk = *(m_end.get_list_iterator());
 
-		if (!has_capacity())
-		{
-			// transform 0-capacity chunk into chunk with capacity
-			last_chunk = chunk{1, typename chunk::capacity_tag{}};
-			m_capacity++;
 
-			m_end.get_chunk_iterator() = last_chunk.begin(); // recalibrate m_end
-		}
-		else if (!current_chunk_has_capacity())
-		{
-			// transform 0-capacity chunk into chunk with capacity
-			last_chunk = chunk{m_size, typename chunk::capacity_tag{}};
-			m_capacity += m_size;
 
-			m_end.get_chunk_iterator() = last_chunk.begin(); // recalibrate m_end
-		}
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	constexpr stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::iterator::iterator() noexcept : raw_iterator{}  {}
 
-		last_chunk.push_back(std::move(new_elem));
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	constexpr stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::iterator::iterator(raw_iterator it) noexcept : raw_iterator{it}  {}
 
-		if (current_chunk_full())
-		{
-			try { push_empty_chunk(); }
-			catch (const std::exception& e)
-			{
-				last_chunk.pop_back();
-				throw;
-			}
-		}
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	constexpr stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::iterator& stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::iterator::operator++() noexcept
+	{
+		return static_cast<iterator&>(raw_iterator::operator++());
+	}
 
-		m_end++;
-		m_size++;
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	constexpr stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::iterator stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::iterator::operator++(int) noexcept
+	{
+		return raw_iterator::operator++(0);
 	}
 
-	template <typename T, typename Allocator, typename ChunkAllocator>
-	constexpr void stable_vector<T, Allocator, ChunkAllocator>::push_back(const T& val)
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	constexpr stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::iterator& stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::iterator::operator--() noexcept
 	{
-		emplace_back(val);
+		return static_cast<iterator&>(raw_iterator::operator--());
 	}
 
-	template <typename T, typename Allocator, typename ChunkAllocator>
-	constexpr void stable_vector<T, Allocator, ChunkAllocator>::push_back(T&& val)
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	constexpr stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::iterator stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::iterator::operator--(int) noexcept
 	{
-		emplace_back(std::move(val));
+		return raw_iterator::operator--(0);
 	}
 
-	template <typename T, typename Allocator, typename ChunkAllocator>
-	constexpr void stable_vector<T, Allocator, ChunkAllocator>::pop_back()
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	constexpr stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::iterator& stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::iterator::operator+=(difference_type n) noexcept
 	{
-		iterator prev = std::prev(end());
-		chunk& current_chunk = *(prev.get_list_iterator());
-		current_chunk.pop_back();
+		return static_cast<iterator&>(raw_iterator::operator+=(n));
+	}
 
-		m_end--;
-		m_size--;
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	constexpr stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::iterator& stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::iterator::operator-=(difference_type n) noexcept
+	{
+		return static_cast<iterator&>(raw_iterator::operator-=(n));
 	}
 
-	template <typename T, typename Allocator, typename ChunkAllocator>
-	constexpr void stable_vector<T, Allocator, ChunkAllocator>::reserve_extra(std::size_t n)
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	constexpr stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::iterator stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::iterator::operator+(difference_type n) const noexcept
 	{
-		static_assert(false);
+		iterator it = *this;
+		return it += n;
 	}
 
-	template <typename T, typename Allocator, typename ChunkAllocator>
-	constexpr void stable_vector<T, Allocator, ChunkAllocator>::clear()
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	constexpr stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::iterator stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::iterator::operator-(difference_type n) const noexcept
 	{
-		m_chunks.clear();
-		
-		m_size = 0;
-		m_end = begin();
+		iterator it = *this;
+		return it -= n;
 	}
 
-	template <typename T, typename Allocator, typename ChunkAllocator>
-	constexpr bool stable_vector<T, Allocator, ChunkAllocator>::empty() const noexcept
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	constexpr stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::iterator::difference_type stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::iterator::operator-(iterator other) const noexcept
 	{
-		return m_size == 0;
+		return raw_iterator::operator-(other);
 	}
 
-	template <typename T, typename Allocator, typename ChunkAllocator>
-	constexpr std::size_t stable_vector<T, Allocator, ChunkAllocator>::size() const noexcept
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	constexpr bool stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::iterator::operator==(iterator other) const noexcept
 	{
-		return m_size;
+		return raw_iterator::operator==(other);
 	}
 
-	template <typename T, typename Allocator, typename ChunkAllocator>
-	constexpr stable_vector<T, Allocator, ChunkAllocator>::iterator stable_vector<T, Allocator, ChunkAllocator>::begin() noexcept
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	constexpr bool stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::iterator::operator==(const_iterator other) const noexcept
 	{
-		return iterator{raw_begin()};
+		return raw_iterator::operator==(other);
 	}
 
-	template <typename T, typename Allocator, typename ChunkAllocator>
-	constexpr stable_vector<T, Allocator, ChunkAllocator>::iterator stable_vector<T, Allocator, ChunkAllocator>::end() noexcept
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	constexpr bool stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::iterator::operator==(reverse_iterator other) const noexcept
 	{
-		return iterator{raw_end()};
+		return raw_iterator::operator==(other);
 	}
 
-	template <typename T, typename Allocator, typename ChunkAllocator>
-	constexpr stable_vector<T, Allocator, ChunkAllocator>::const_iterator stable_vector<T, Allocator, ChunkAllocator>::cbegin() const noexcept
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	constexpr bool stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::iterator::operator==(const_reverse_iterator other) const noexcept
 	{
-		return const_iterator{const_cast<stable_vector<T, Allocator, ChunkAllocator>&>(*this).raw_begin()};
+		return raw_iterator::operator==(other);
 	}
 
-	template <typename T, typename Allocator, typename ChunkAllocator>
-	constexpr stable_vector<T, Allocator, ChunkAllocator>::const_iterator stable_vector<T, Allocator, ChunkAllocator>::cend() const noexcept
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	constexpr std::strong_ordering stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::iterator::operator<=>(iterator other) const noexcept
 	{
-		return const_iterator{const_cast<stable_vector<T, Allocator, ChunkAllocator>&>(*this).raw_end()};
+		return raw_iterator::operator<=>(other);
 	}
 
-	template <typename T, typename Allocator, typename ChunkAllocator>
-	constexpr stable_vector<T, Allocator, ChunkAllocator>::reverse_iterator stable_vector<T, Allocator, ChunkAllocator>::rbegin() noexcept
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	constexpr stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::iterator::reference stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::iterator::operator*() const noexcept
 	{
-		return reverse_iterator{raw_before_end()};
+		return raw_iterator::operator*();
 	}
 
-	template <typename T, typename Allocator, typename ChunkAllocator>
-	constexpr stable_vector<T, Allocator, ChunkAllocator>::reverse_iterator stable_vector<T, Allocator, ChunkAllocator>::rend() noexcept
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	constexpr stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::iterator::pointer stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::iterator::operator->() const noexcept
 	{
-		return reverse_iterator{raw_before_begin()};
+		return raw_iterator::operator->();
 	}
 
-	template <typename T, typename Allocator, typename ChunkAllocator>
-	constexpr stable_vector<T, Allocator, ChunkAllocator>::const_reverse_iterator stable_vector<T, Allocator, ChunkAllocator>::crbegin() const noexcept
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	constexpr stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::iterator::reference stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::iterator::operator[](difference_type n) const noexcept
 	{
-		return const_reverse_iterator{const_cast<stable_vector<T, Allocator, ChunkAllocator>&>(*this).raw_before_end()};
+		return *(*this + n);
 	}
 
-	template <typename T, typename Allocator, typename ChunkAllocator>
-	constexpr stable_vector<T, Allocator, ChunkAllocator>::const_reverse_iterator stable_vector<T, Allocator, ChunkAllocator>::crend() const noexcept
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	constexpr void swap(typename stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::iterator& a, typename stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::iterator& b) noexcept
 	{
-		return const_reverse_iterator{const_cast<stable_vector<T, Allocator, ChunkAllocator>&>(*this).raw_before_begin()};
+		swap<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>(static_cast<stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::raw_iterator&>(a), static_cast<stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::raw_iterator&>(b));
 	}
 
 
@@ -1903,183 +2697,122 @@ namespace my_adt
 
 
 
-	template <typename T, typename Allocator, typename ChunkAllocator>
-	constexpr void stable_vector<T, Allocator, ChunkAllocator>::raw_iterator::increment() noexcept
-	{
-		chunk& current_chunk = *m_list_iterator;
-		chunk_iterator_type next_chunk_iterator = std::next(m_chunk_iterator);
 
-		if (next_chunk_iterator == current_chunk.cap_end())
-		{
-			chunk& next_chunk = *(++m_list_iterator);
-			m_chunk_iterator = next_chunk.begin();
-		}
-		else
-		{
-			m_chunk_iterator++;
-		}
-	}
 
-	template <typename T, typename Allocator, typename ChunkAllocator>
-	constexpr void stable_vector<T, Allocator, ChunkAllocator>::raw_iterator::decrement() noexcept
-	{
-		chunk& current_chunk = *m_list_iterator;
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	constexpr stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::const_iterator::const_iterator() noexcept : raw_iterator{}  {}
 
-		if (m_chunk_iterator == current_chunk.begin())
-		{
-			chunk& prev_chunk = *(--m_list_iterator);
-			m_chunk_iterator = std::prev(prev_chunk.cap_end());
-		}
-		else
-		{
-			m_chunk_iterator--;
-		}
-	}
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	constexpr stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::const_iterator::const_iterator(raw_iterator it) noexcept : raw_iterator{it}  {}
 
-	template <typename T, typename Allocator, typename ChunkAllocator>
-	constexpr stable_vector<T, Allocator, ChunkAllocator>::raw_iterator::list_iterator_type& stable_vector<T, Allocator, ChunkAllocator>::raw_iterator::get_list_iterator() noexcept
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	constexpr stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::const_iterator& stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::const_iterator::operator++() noexcept
 	{
-		return m_list_iterator;
+		return static_cast<const_iterator&>(raw_iterator::operator++());
 	}
 
-	template <typename T, typename Allocator, typename ChunkAllocator>
-	constexpr stable_vector<T, Allocator, ChunkAllocator>::raw_iterator::chunk_iterator_type& stable_vector<T, Allocator, ChunkAllocator>::raw_iterator::get_chunk_iterator() noexcept
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	constexpr stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::const_iterator stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::const_iterator::operator++(int) noexcept
 	{
-		return m_chunk_iterator;
+		return raw_iterator::operator++(0);
 	}
 
-	template <typename T, typename Allocator, typename ChunkAllocator>
-	constexpr stable_vector<T, Allocator, ChunkAllocator>::raw_iterator stable_vector<T, Allocator, ChunkAllocator>::raw_begin() noexcept
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	constexpr stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::const_iterator& stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::const_iterator::operator--() noexcept
 	{
-		list_iterator second_it = std::next(m_chunks.begin());
-		chunk& second = *second_it;
-		return raw_iterator{second_it, second.begin()};
+		return static_cast<const_iterator&>(raw_iterator::operator--());
 	}
 
-	template <typename T, typename Allocator, typename ChunkAllocator>
-	constexpr stable_vector<T, Allocator, ChunkAllocator>::raw_iterator stable_vector<T, Allocator, ChunkAllocator>::raw_end() noexcept
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	constexpr stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::const_iterator stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::const_iterator::operator--(int) noexcept
 	{
-		if (!has_capacity())
-		{
-			return raw_begin();
-		}
-		else
-		{
-			return m_end;
-		}
+		return raw_iterator::operator--(0);
 	}
 
-	template <typename T, typename Allocator, typename ChunkAllocator>
-	constexpr stable_vector<T, Allocator, ChunkAllocator>::raw_iterator stable_vector<T, Allocator, ChunkAllocator>::raw_before_end() noexcept
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	constexpr stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::const_iterator& stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::const_iterator::operator+=(difference_type n) noexcept
 	{
-		if (!has_capacity())
-		{
-			return raw_begin();
-		}
-		else
-		{
-			return std::prev(raw_end());
-		}
+		return static_cast<const_iterator&>(raw_iterator::operator+=(n));
 	}
 
-	template <typename T, typename Allocator, typename ChunkAllocator>
-	constexpr stable_vector<T, Allocator, ChunkAllocator>::raw_iterator stable_vector<T, Allocator, ChunkAllocator>::raw_before_begin() noexcept
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	constexpr stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::const_iterator& stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::const_iterator::operator-=(difference_type n) noexcept
 	{
-		if (!has_capacity())
-		{
-			return raw_begin();
-		}
-		else
-		{
-			return std::prev(raw_begin());
-		}
+		return static_cast<const_iterator&>(raw_iterator::operator-=(n));
 	}
 
-	template <typename T, typename Allocator, typename ChunkAllocator>
-	constexpr stable_vector<T, Allocator, ChunkAllocator>::raw_iterator::raw_iterator() noexcept : m_list_iterator{}, m_chunk_iterator{}  {}
-
-	template <typename T, typename Allocator, typename ChunkAllocator>
-	constexpr stable_vector<T, Allocator, ChunkAllocator>::raw_iterator::raw_iterator(list_iterator_type list_iterator,
-																						  chunk_iterator_type chunk_iterator)  noexcept : m_list_iterator{list_iterator},
-																						  												  m_chunk_iterator{chunk_iterator}  {}
-
-	template <typename T, typename Allocator, typename ChunkAllocator>
-	constexpr stable_vector<T, Allocator, ChunkAllocator>::raw_iterator& stable_vector<T, Allocator, ChunkAllocator>::raw_iterator::operator++() noexcept
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	constexpr stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::const_iterator stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::const_iterator::operator+(difference_type n) const noexcept
 	{
-		increment();
-		return *this;
+		const_iterator it = *this;
+		return it += n;
 	}
 
-	template <typename T, typename Allocator, typename ChunkAllocator>
-	constexpr stable_vector<T, Allocator, ChunkAllocator>::raw_iterator stable_vector<T, Allocator, ChunkAllocator>::raw_iterator::operator++(int) noexcept
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	constexpr stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::const_iterator stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::const_iterator::operator-(difference_type n) const noexcept
 	{
-		stable_vector<T, Allocator, ChunkAllocator>::iterator prev_it = *this;
-		increment();
-		return prev_it;
+		const_iterator it = *this;
+		return it -= n;
 	}
 
-	template <typename T, typename Allocator, typename ChunkAllocator>
-	constexpr stable_vector<T, Allocator, ChunkAllocator>::raw_iterator& stable_vector<T, Allocator, ChunkAllocator>::raw_iterator::operator--() noexcept
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	constexpr stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::const_iterator::difference_type stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::const_iterator::operator-(const_iterator other) const noexcept
 	{
-		decrement();
-		return *this;
+		return raw_iterator::operator-(other);
 	}
 
-	template <typename T, typename Allocator, typename ChunkAllocator>
-	constexpr stable_vector<T, Allocator, ChunkAllocator>::raw_iterator stable_vector<T, Allocator, ChunkAllocator>::raw_iterator::operator--(int) noexcept
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	constexpr bool stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::const_iterator::operator==(iterator other) const noexcept
 	{
-		stable_vector<T, Allocator, ChunkAllocator>::iterator prev_it = *this;
-		decrement();
-		return prev_it;
+		return raw_iterator::operator==(other);
 	}
 
-	template <typename T, typename Allocator, typename ChunkAllocator>
-	constexpr bool stable_vector<T, Allocator, ChunkAllocator>::raw_iterator::operator==(raw_iterator other) const noexcept
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	constexpr bool stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::const_iterator::operator==(const_iterator other) const noexcept
 	{
-		return (m_list_iterator == other.m_list_iterator)  &&  (m_chunk_iterator == other.m_chunk_iterator);
+		return raw_iterator::operator==(other);
 	}
 
-	template <typename T, typename Allocator, typename ChunkAllocator>
-	constexpr bool stable_vector<T, Allocator, ChunkAllocator>::raw_iterator::operator==(iterator other) const noexcept
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	constexpr bool stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::const_iterator::operator==(reverse_iterator other) const noexcept
 	{
-		return operator==(static_cast<raw_iterator>(other));
+		return raw_iterator::operator==(other);
 	}
 
-	template <typename T, typename Allocator, typename ChunkAllocator>
-	constexpr bool stable_vector<T, Allocator, ChunkAllocator>::raw_iterator::operator==(const_iterator other) const noexcept
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	constexpr bool stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::const_iterator::operator==(const_reverse_iterator other) const noexcept
 	{
-		return operator==(static_cast<raw_iterator>(other));
+		return raw_iterator::operator==(other);
 	}
 
-	template <typename T, typename Allocator, typename ChunkAllocator>
-	constexpr bool stable_vector<T, Allocator, ChunkAllocator>::raw_iterator::operator==(reverse_iterator other) const noexcept
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	constexpr std::strong_ordering stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::const_iterator::operator<=>(const_iterator other) const noexcept
 	{
-		return operator==(static_cast<raw_iterator>(other));
+		return raw_iterator::operator<=>(other);
 	}
 
-	template <typename T, typename Allocator, typename ChunkAllocator>
-	constexpr bool stable_vector<T, Allocator, ChunkAllocator>::raw_iterator::operator==(const_reverse_iterator other) const noexcept
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	constexpr stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::const_iterator::reference stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::const_iterator::operator*() const noexcept
 	{
-		return operator==(static_cast<raw_iterator>(other));
+		return raw_iterator::operator*();
 	}
 
-	template <typename T, typename Allocator, typename ChunkAllocator>
-	constexpr stable_vector<T, Allocator, ChunkAllocator>::raw_iterator::reference stable_vector<T, Allocator, ChunkAllocator>::raw_iterator::operator*() noexcept
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	constexpr stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::const_iterator::pointer stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::const_iterator::operator->() const noexcept
 	{
-		return *m_chunk_iterator;
+		return raw_iterator::operator->();
 	}
 
-	template <typename T, typename Allocator, typename ChunkAllocator>
-	constexpr stable_vector<T, Allocator, ChunkAllocator>::raw_iterator::pointer stable_vector<T, Allocator, ChunkAllocator>::raw_iterator::operator->() noexcept
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	constexpr stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::const_iterator::reference stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::const_iterator::operator[](difference_type n) const noexcept
 	{
-		return &*m_chunk_iterator;
+		return *(*this + n);
 	}
 
-	template <typename T, typename Allocator, typename ChunkAllocator>
-	constexpr void swap(typename stable_vector<T, Allocator, ChunkAllocator>::raw_iterator& a, typename stable_vector<T, Allocator, ChunkAllocator>::raw_iterator& b) noexcept
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	constexpr void swap(typename stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::const_iterator& a, typename stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::const_iterator& b) noexcept
 	{
-		swap(a.m_list_iterator, b.m_list_iterator);
-		swap<T, Allocator>(a.m_chunk_iterator, b.m_chunk_iterator);
+		swap<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>(static_cast<stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::raw_iterator&>(a), static_cast<stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::raw_iterator&>(b));
 	}
 
 
@@ -2087,164 +2820,123 @@ namespace my_adt
 
 
 
-	template <typename T, typename Allocator, typename ChunkAllocator>
-	constexpr stable_vector<T, Allocator, ChunkAllocator>::iterator::iterator() noexcept : raw_iterator{}  {}
 
-	template <typename T, typename Allocator, typename ChunkAllocator>
-	constexpr stable_vector<T, Allocator, ChunkAllocator>::iterator::iterator(raw_iterator it) : raw_iterator{it}  {}
 
-	template <typename T, typename Allocator, typename ChunkAllocator>
-	constexpr stable_vector<T, Allocator, ChunkAllocator>::iterator::iterator(raw_iterator::list_iterator_type list_iterator, raw_iterator::chunk_iterator_type chunk_iterator) noexcept : raw_iterator{list_iterator, chunk_iterator}  {}
-
-	template <typename T, typename Allocator, typename ChunkAllocator>
-	constexpr stable_vector<T, Allocator, ChunkAllocator>::iterator& stable_vector<T, Allocator, ChunkAllocator>::iterator::operator++() noexcept
-	{
-		return static_cast<iterator&>(raw_iterator::operator++());
-	}
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	constexpr stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::reverse_iterator::reverse_iterator() noexcept : raw_iterator{}  {}
 
-	template <typename T, typename Allocator, typename ChunkAllocator>
-	constexpr stable_vector<T, Allocator, ChunkAllocator>::iterator stable_vector<T, Allocator, ChunkAllocator>::iterator::operator++(int) noexcept
-	{
-		return raw_iterator::operator++(0);
-	}
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	constexpr stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::reverse_iterator::reverse_iterator(raw_iterator it) noexcept : raw_iterator{it}  {}
 
-	template <typename T, typename Allocator, typename ChunkAllocator>
-	constexpr stable_vector<T, Allocator, ChunkAllocator>::iterator& stable_vector<T, Allocator, ChunkAllocator>::iterator::operator--() noexcept
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	constexpr stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::reverse_iterator& stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::reverse_iterator::operator++() noexcept
 	{
-		return static_cast<iterator&>(raw_iterator::operator--());
+		return static_cast<reverse_iterator&>(raw_iterator::operator--());
 	}
 
-	template <typename T, typename Allocator, typename ChunkAllocator>
-	constexpr stable_vector<T, Allocator, ChunkAllocator>::iterator stable_vector<T, Allocator, ChunkAllocator>::iterator::operator--(int) noexcept
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	constexpr stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::reverse_iterator stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::reverse_iterator::operator++(int) noexcept
 	{
 		return raw_iterator::operator--(0);
 	}
 
-	template <typename T, typename Allocator, typename ChunkAllocator>
-	constexpr bool stable_vector<T, Allocator, ChunkAllocator>::iterator::operator==(iterator other) const noexcept
-	{
-		return raw_iterator::operator==(other);
-	}
-
-	template <typename T, typename Allocator, typename ChunkAllocator>
-	constexpr bool stable_vector<T, Allocator, ChunkAllocator>::iterator::operator==(const_iterator other) const noexcept
-	{
-		return raw_iterator::operator==(other);
-	}
-
-	template <typename T, typename Allocator, typename ChunkAllocator>
-	constexpr bool stable_vector<T, Allocator, ChunkAllocator>::iterator::operator==(reverse_iterator other) const noexcept
-	{
-		return raw_iterator::operator==(other);
-	}
-
-	template <typename T, typename Allocator, typename ChunkAllocator>
-	constexpr bool stable_vector<T, Allocator, ChunkAllocator>::iterator::operator==(const_reverse_iterator other) const noexcept
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	constexpr stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::reverse_iterator& stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::reverse_iterator::operator--() noexcept
 	{
-		return raw_iterator::operator==(other);
+		return static_cast<reverse_iterator&>(raw_iterator::operator++());
 	}
 
-	template <typename T, typename Allocator, typename ChunkAllocator>
-	constexpr stable_vector<T, Allocator, ChunkAllocator>::iterator::reference stable_vector<T, Allocator, ChunkAllocator>::iterator::operator*() noexcept
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	constexpr stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::reverse_iterator stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::reverse_iterator::operator--(int) noexcept
 	{
-		return raw_iterator::operator*();
+		return raw_iterator::operator++(0);
 	}
 
-	template <typename T, typename Allocator, typename ChunkAllocator>
-	constexpr stable_vector<T, Allocator, ChunkAllocator>::iterator::pointer stable_vector<T, Allocator, ChunkAllocator>::iterator::operator->() noexcept
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	constexpr stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::reverse_iterator& stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::reverse_iterator::operator+=(difference_type n) noexcept
 	{
-		return raw_iterator::operator->();
+		return static_cast<reverse_iterator&>(raw_iterator::operator-=(n));
 	}
 
-	template <typename T, typename Allocator, typename ChunkAllocator>
-	constexpr void swap(typename stable_vector<T, Allocator, ChunkAllocator>::iterator& a, typename stable_vector<T, Allocator, ChunkAllocator>::iterator& b) noexcept
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	constexpr stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::reverse_iterator& stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::reverse_iterator::operator-=(difference_type n) noexcept
 	{
-		swap<T, Allocator, ChunkAllocator>(static_cast<stable_vector<T, Allocator, ChunkAllocator>::raw_iterator&>(a), static_cast<stable_vector<T, Allocator, ChunkAllocator>::raw_iterator&>(b));
+		return static_cast<reverse_iterator&>(raw_iterator::operator+=(n));
 	}
 
-
-
-
-
-
-
-
-
-	template <typename T, typename Allocator, typename ChunkAllocator>
-	constexpr stable_vector<T, Allocator, ChunkAllocator>::const_iterator::const_iterator() noexcept : raw_iterator{}  {}
-
-	template <typename T, typename Allocator, typename ChunkAllocator>
-	constexpr stable_vector<T, Allocator, ChunkAllocator>::const_iterator::const_iterator(raw_iterator it) : raw_iterator{it}  {}
-
-	template <typename T, typename Allocator, typename ChunkAllocator>
-	constexpr stable_vector<T, Allocator, ChunkAllocator>::const_iterator::const_iterator(raw_iterator::list_iterator_type list_iterator, raw_iterator::chunk_iterator_type chunk_iterator) noexcept : raw_iterator{list_iterator, chunk_iterator}  {}
-
-	template <typename T, typename Allocator, typename ChunkAllocator>
-	constexpr stable_vector<T, Allocator, ChunkAllocator>::const_iterator& stable_vector<T, Allocator, ChunkAllocator>::const_iterator::operator++() noexcept
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	constexpr stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::reverse_iterator stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::reverse_iterator::operator+(difference_type n) const noexcept
 	{
-		return static_cast<const_iterator&>(raw_iterator::operator++());
+		reverse_iterator it = *this;
+		return it += n;
 	}
 
-	template <typename T, typename Allocator, typename ChunkAllocator>
-	constexpr stable_vector<T, Allocator, ChunkAllocator>::const_iterator stable_vector<T, Allocator, ChunkAllocator>::const_iterator::operator++(int) noexcept
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	constexpr stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::reverse_iterator stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::reverse_iterator::operator-(difference_type n) const noexcept
 	{
-		return raw_iterator::operator++(0);
+		reverse_iterator it = *this;
+		return it -= n;
 	}
 
-	template <typename T, typename Allocator, typename ChunkAllocator>
-	constexpr stable_vector<T, Allocator, ChunkAllocator>::const_iterator& stable_vector<T, Allocator, ChunkAllocator>::const_iterator::operator--() noexcept
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	constexpr stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::reverse_iterator::difference_type stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::reverse_iterator::operator-(reverse_iterator other) const noexcept
 	{
-		return static_cast<const_iterator&>(raw_iterator::operator--());
+		return -raw_iterator::operator-(other);
 	}
 
-	template <typename T, typename Allocator, typename ChunkAllocator>
-	constexpr stable_vector<T, Allocator, ChunkAllocator>::const_iterator stable_vector<T, Allocator, ChunkAllocator>::const_iterator::operator--(int) noexcept
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	constexpr bool stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::reverse_iterator::operator==(iterator other) const noexcept
 	{
-		return raw_iterator::operator--(0);
+		return raw_iterator::operator==(other);
 	}
 
-	template <typename T, typename Allocator, typename ChunkAllocator>
-	constexpr bool stable_vector<T, Allocator, ChunkAllocator>::const_iterator::operator==(iterator other) const noexcept
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	constexpr bool stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::reverse_iterator::operator==(const_iterator other) const noexcept
 	{
 		return raw_iterator::operator==(other);
 	}
 
-	template <typename T, typename Allocator, typename ChunkAllocator>
-	constexpr bool stable_vector<T, Allocator, ChunkAllocator>::const_iterator::operator==(const_iterator other) const noexcept
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	constexpr bool stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::reverse_iterator::operator==(reverse_iterator other) const noexcept
 	{
 		return raw_iterator::operator==(other);
 	}
-	
-	template <typename T, typename Allocator, typename ChunkAllocator>
-	constexpr bool stable_vector<T, Allocator, ChunkAllocator>::const_iterator::operator==(reverse_iterator other) const noexcept
+
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	constexpr bool stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::reverse_iterator::operator==(const_reverse_iterator other) const noexcept
 	{
 		return raw_iterator::operator==(other);
 	}
 
-	template <typename T, typename Allocator, typename ChunkAllocator>
-	constexpr bool stable_vector<T, Allocator, ChunkAllocator>::const_iterator::operator==(const_reverse_iterator other) const noexcept
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	constexpr std::strong_ordering stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::reverse_iterator::operator<=>(reverse_iterator other) const noexcept
 	{
-		return raw_iterator::operator==(other);
+		return 0 <=> raw_iterator::operator<=>(other);
 	}
 
-	template <typename T, typename Allocator, typename ChunkAllocator>
-	constexpr stable_vector<T, Allocator, ChunkAllocator>::const_iterator::reference stable_vector<T, Allocator, ChunkAllocator>::const_iterator::operator*() noexcept
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	constexpr stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::reverse_iterator::reference stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::reverse_iterator::operator*() const noexcept
 	{
 		return raw_iterator::operator*();
 	}
 
-	template <typename T, typename Allocator, typename ChunkAllocator>
-	constexpr stable_vector<T, Allocator, ChunkAllocator>::const_iterator::pointer stable_vector<T, Allocator, ChunkAllocator>::const_iterator::operator->() noexcept
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	constexpr stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::reverse_iterator::pointer stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::reverse_iterator::operator->() const noexcept
 	{
 		return raw_iterator::operator->();
 	}
 
-	template <typename T, typename Allocator, typename ChunkAllocator>
-	constexpr void swap(typename stable_vector<T, Allocator, ChunkAllocator>::const_iterator& a, typename stable_vector<T, Allocator, ChunkAllocator>::const_iterator& b) noexcept
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	constexpr stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::reverse_iterator::reference stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::reverse_iterator::operator[](difference_type n) const noexcept
 	{
-		swap(static_cast<stable_vector<T, Allocator, ChunkAllocator>::raw_iterator&>(a), static_cast<stable_vector<T, Allocator, ChunkAllocator>::raw_iterator&>(b));
+		return *(*this + n);
 	}
 
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	constexpr void swap(typename stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::reverse_iterator& a, typename stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::reverse_iterator& b) noexcept
+	{
+		swap<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>(static_cast<stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::raw_iterator&>(a), static_cast<stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::raw_iterator&>(b));
+	}
 
 
 
@@ -2253,164 +2945,2694 @@ namespace my_adt
 
 
 
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	constexpr stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::const_reverse_iterator::const_reverse_iterator() noexcept : raw_iterator{}  {}
 
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	constexpr stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::const_reverse_iterator::const_reverse_iterator(raw_iterator it) noexcept : raw_iterator{it}  {}
 
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	constexpr stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::const_reverse_iterator& stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::const_reverse_iterator::operator++() noexcept
+	{
+		return static_cast<const_reverse_iterator&>(raw_iterator::operator--());
+	}
 
-	template <typename T, typename Allocator, typename ChunkAllocator>
-	constexpr stable_vector<T, Allocator, ChunkAllocator>::reverse_iterator::reverse_iterator() noexcept : raw_iterator{}  {}
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	constexpr stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::const_reverse_iterator stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::const_reverse_iterator::operator++(int) noexcept
+	{
+		return raw_iterator::operator--(0);
+	}
 
-	template <typename T, typename Allocator, typename ChunkAllocator>
-	constexpr stable_vector<T, Allocator, ChunkAllocator>::reverse_iterator::reverse_iterator(raw_iterator it) : raw_iterator{it}  {}
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	constexpr stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::const_reverse_iterator& stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::const_reverse_iterator::operator--() noexcept
+	{
+		return static_cast<const_reverse_iterator&>(raw_iterator::operator++());
+	}
 
-	template <typename T, typename Allocator, typename ChunkAllocator>
-	constexpr stable_vector<T, Allocator, ChunkAllocator>::reverse_iterator::reverse_iterator(raw_iterator::list_iterator_type list_iterator, raw_iterator::chunk_iterator_type chunk_iterator) noexcept : raw_iterator{list_iterator, chunk_iterator}  {}
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	constexpr stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::const_reverse_iterator stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::const_reverse_iterator::operator--(int) noexcept
+	{
+		return raw_iterator::operator++(0);
+	}
 
-	template <typename T, typename Allocator, typename ChunkAllocator>
-	constexpr stable_vector<T, Allocator, ChunkAllocator>::reverse_iterator& stable_vector<T, Allocator, ChunkAllocator>::reverse_iterator::operator++() noexcept
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	constexpr stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::const_reverse_iterator& stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::const_reverse_iterator::operator+=(difference_type n) noexcept
 	{
-		return static_cast<reverse_iterator&>(raw_iterator::operator--());
+		return static_cast<const_reverse_iterator&>(raw_iterator::operator-=(n));
 	}
 
-	template <typename T, typename Allocator, typename ChunkAllocator>
-	constexpr stable_vector<T, Allocator, ChunkAllocator>::reverse_iterator stable_vector<T, Allocator, ChunkAllocator>::reverse_iterator::operator++(int) noexcept
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	constexpr stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::const_reverse_iterator& stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::const_reverse_iterator::operator-=(difference_type n) noexcept
 	{
-		return raw_iterator::operator--(0);
+		return static_cast<const_reverse_iterator&>(raw_iterator::operator+=(n));
 	}
 
-	template <typename T, typename Allocator, typename ChunkAllocator>
-	constexpr stable_vector<T, Allocator, ChunkAllocator>::reverse_iterator& stable_vector<T, Allocator, ChunkAllocator>::reverse_iterator::operator--() noexcept
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	constexpr stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::const_reverse_iterator stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::const_reverse_iterator::operator+(difference_type n) const noexcept
 	{
-		return static_cast<reverse_iterator&>(raw_iterator::operator++());
+		const_reverse_iterator it = *this;
+		return it += n;
 	}
 
-	template <typename T, typename Allocator, typename ChunkAllocator>
-	constexpr stable_vector<T, Allocator, ChunkAllocator>::reverse_iterator stable_vector<T, Allocator, ChunkAllocator>::reverse_iterator::operator--(int) noexcept
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	constexpr stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::const_reverse_iterator stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::const_reverse_iterator::operator-(difference_type n) const noexcept
 	{
-		return raw_iterator::operator++(0);
+		const_reverse_iterator it = *this;
+		return it -= n;
+	}
+
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	constexpr stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::const_reverse_iterator::difference_type stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::const_reverse_iterator::operator-(const_reverse_iterator other) const noexcept
+	{
+		return -raw_iterator::operator-(other);
 	}
 
-	template <typename T, typename Allocator, typename ChunkAllocator>
-	constexpr bool stable_vector<T, Allocator, ChunkAllocator>::reverse_iterator::operator==(iterator other) const noexcept
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	constexpr bool stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::const_reverse_iterator::operator==(iterator other) const noexcept
 	{
 		return raw_iterator::operator==(other);
 	}
 
-	template <typename T, typename Allocator, typename ChunkAllocator>
-	constexpr bool stable_vector<T, Allocator, ChunkAllocator>::reverse_iterator::operator==(const_iterator other) const noexcept
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	constexpr bool stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::const_reverse_iterator::operator==(const_iterator other) const noexcept
 	{
 		return raw_iterator::operator==(other);
 	}
 
-	template <typename T, typename Allocator, typename ChunkAllocator>
-	constexpr bool stable_vector<T, Allocator, ChunkAllocator>::reverse_iterator::operator==(reverse_iterator other) const noexcept
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	constexpr bool stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::const_reverse_iterator::operator==(reverse_iterator other) const noexcept
 	{
 		return raw_iterator::operator==(other);
 	}
 
-	template <typename T, typename Allocator, typename ChunkAllocator>
-	constexpr bool stable_vector<T, Allocator, ChunkAllocator>::reverse_iterator::operator==(const_reverse_iterator other) const noexcept
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	constexpr bool stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::const_reverse_iterator::operator==(const_reverse_iterator other) const noexcept
 	{
 		return raw_iterator::operator==(other);
 	}
 
-	template <typename T, typename Allocator, typename ChunkAllocator>
-	constexpr stable_vector<T, Allocator, ChunkAllocator>::reverse_iterator::reference stable_vector<T, Allocator, ChunkAllocator>::reverse_iterator::operator*() noexcept
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	constexpr std::strong_ordering stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::const_reverse_iterator::operator<=>(const_reverse_iterator other) const noexcept
+	{
+		return 0 <=> raw_iterator::operator<=>(other);
+	}
+
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	constexpr stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::const_reverse_iterator::reference stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::const_reverse_iterator::operator*() const noexcept
 	{
 		return raw_iterator::operator*();
 	}
 
-	template <typename T, typename Allocator, typename ChunkAllocator>
-	constexpr stable_vector<T, Allocator, ChunkAllocator>::reverse_iterator::pointer stable_vector<T, Allocator, ChunkAllocator>::reverse_iterator::operator->() noexcept
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	constexpr stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::const_reverse_iterator::pointer stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::const_reverse_iterator::operator->() const noexcept
 	{
 		return raw_iterator::operator->();
 	}
 
-	template <typename T, typename Allocator, typename ChunkAllocator>
-	constexpr void swap(typename stable_vector<T, Allocator, ChunkAllocator>::reverse_iterator& a, typename stable_vector<T, Allocator, ChunkAllocator>::reverse_iterator& b) noexcept
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	constexpr stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::const_reverse_iterator::reference stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::const_reverse_iterator::operator[](difference_type n) const noexcept
 	{
-		swap(static_cast<stable_vector<T, Allocator, ChunkAllocator>::raw_iterator&>(a), static_cast<stable_vector<T, Allocator, ChunkAllocator>::raw_iterator&>(b));
+		return *(*this + n);
 	}
 
+	template <typename T, typename Allocator, typename ChunkAllocator, typename GrowthPolicy, std::size_t InlineCapacity>
+	constexpr void swap(typename stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::const_reverse_iterator& a, typename stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::const_reverse_iterator& b) noexcept
+	{
+		swap<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>(static_cast<stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::raw_iterator&>(a), static_cast<stable_vector<T, Allocator, ChunkAllocator, GrowthPolicy, InlineCapacity>::raw_iterator&>(b));
+	}
 
 
 
+#if defined(__linux__)
+	namespace detail
+	{
+		inline std::size_t page_size() noexcept
+		{
+			static const std::size_t size = static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+			return size;
+		}
 
+		inline std::size_t round_up_to_page(std::size_t bytes) noexcept
+		{
+			return (bytes + page_size() - 1) & ~(page_size() - 1);
+		}
 
+		// address space that faults on access until pages are committed or mapped over it with MAP_FIXED
+		inline void* reserve_address_space(std::size_t bytes)
+		{
+			void* ptr = ::mmap(nullptr, bytes, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+			if (ptr == MAP_FAILED)
+			{
+				throw std::bad_alloc{};
+			}
+			return ptr;
+		}
+	}
 
+	// stable and contiguous: reserves address space for max_size() elements up front with mmap(PROT_NONE) and
+	// commits pages with mprotect as the container grows, so elements never move, data() spans the whole
+	// container and indexing has no chunk lookup. growing past max_size() throws std::length_error
+	template <typename T>
+	class contiguous_stable_vector
+	{
+		static_assert(alignof(T) <= 4096, "over-aligned types need more than page alignment");
 
+		public:
+			using value_type = T;
+			using size_type = std::size_t;
+			using difference_type = std::ptrdiff_t;
+			using reference = T&;
+			using const_reference = const T&;
+			using pointer = T*;
+			using const_pointer = const T*;
+			using iterator = T*;
+			using const_iterator = const T*;
+			using reverse_iterator = std::reverse_iterator<iterator>;
+			using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+			static constexpr std::size_t default_reserved_bytes = std::size_t{1} << 36;
 
-	template <typename T, typename Allocator, typename ChunkAllocator>
-	constexpr stable_vector<T, Allocator, ChunkAllocator>::const_reverse_iterator::const_reverse_iterator() noexcept : raw_iterator{}  {}
+		private:
+			// committed ranges grow geometrically from this size so mprotect calls stay rare
+			static constexpr std::size_t min_commit_bytes = std::size_t{1} << 16;
 
-	template <typename T, typename Allocator, typename ChunkAllocator>
-	constexpr stable_vector<T, Allocator, ChunkAllocator>::const_reverse_iterator::const_reverse_iterator(raw_iterator it) : raw_iterator{it}  {}
+			T* m_data;
+			std::size_t m_size;
+			std::size_t m_capacity;
+			std::size_t m_max_size;
+			std::size_t m_reserved_bytes;
 
-	template <typename T, typename Allocator, typename ChunkAllocator>
-	constexpr stable_vector<T, Allocator, ChunkAllocator>::const_reverse_iterator::const_reverse_iterator(raw_iterator::list_iterator_type list_iterator, raw_iterator::chunk_iterator_type chunk_iterator) noexcept : raw_iterator{list_iterator, chunk_iterator}  {}
+			void commit(std::size_t n);
 
-	template <typename T, typename Allocator, typename ChunkAllocator>
-	constexpr stable_vector<T, Allocator, ChunkAllocator>::const_reverse_iterator& stable_vector<T, Allocator, ChunkAllocator>::const_reverse_iterator::operator++() noexcept
-	{
-		return static_cast<const_reverse_iterator&>(raw_iterator::operator--());
-	}
+		public:
+			explicit contiguous_stable_vector(std::size_t max_size = default_reserved_bytes / sizeof(T));
+			contiguous_stable_vector(const contiguous_stable_vector<T>& other);
+			contiguous_stable_vector(contiguous_stable_vector<T>&& other) noexcept;
+			~contiguous_stable_vector();
 
-	template <typename T, typename Allocator, typename ChunkAllocator>
-	constexpr stable_vector<T, Allocator, ChunkAllocator>::const_reverse_iterator stable_vector<T, Allocator, ChunkAllocator>::const_reverse_iterator::operator++(int) noexcept
-	{
-		return raw_iterator::operator--(0);
-	}
+			contiguous_stable_vector<T>& operator=(contiguous_stable_vector<T> other) noexcept;
 
-	template <typename T, typename Allocator, typename ChunkAllocator>
-	constexpr stable_vector<T, Allocator, ChunkAllocator>::const_reverse_iterator& stable_vector<T, Allocator, ChunkAllocator>::const_reverse_iterator::operator--() noexcept
-	{
-		return static_cast<const_reverse_iterator&>(raw_iterator::operator++());
-	}
+			template <typename... Args>
+			T& emplace_back(Args&&... args);
+			void push_back(const T& val);
+			void push_back(T&& val);
+			void pop_back() noexcept;
+
+			T& operator[](std::size_t index) noexcept;
+			const T& operator[](std::size_t index) const noexcept;
+			T& at(std::size_t index);
+			const T& at(std::size_t index) const;
+
+			T* data() noexcept;
+			const T* data() const noexcept;
+			std::span<T> span() noexcept;
+			std::span<const T> span() const noexcept;
+
+			// commits pages for n elements; never moves elements
+			void reserve(std::size_t n);
+			std::size_t capacity() const noexcept;
+			std::size_t max_size() const noexcept;
+			// returns committed pages past the last element to the kernel
+			void release_unused() noexcept;
+			void clear() noexcept;
+
+			bool empty() const noexcept;
+			std::size_t size() const noexcept;
+
+			iterator begin() noexcept;
+			iterator end() noexcept;
+			const_iterator begin() const noexcept;
+			const_iterator end() const noexcept;
+			const_iterator cbegin() const noexcept;
+			const_iterator cend() const noexcept;
+
+			reverse_iterator rbegin() noexcept;
+			reverse_iterator rend() noexcept;
+			const_reverse_iterator crbegin() const noexcept;
+			const_reverse_iterator crend() const noexcept;
+
+			template <typename U>
+			friend void swap(contiguous_stable_vector<U>& a, contiguous_stable_vector<U>& b) noexcept;
+	};
 
-	template <typename T, typename Allocator, typename ChunkAllocator>
-	constexpr stable_vector<T, Allocator, ChunkAllocator>::const_reverse_iterator stable_vector<T, Allocator, ChunkAllocator>::const_reverse_iterator::operator--(int) noexcept
+	template <typename T>
+	void swap(contiguous_stable_vector<T>& a, contiguous_stable_vector<T>& b) noexcept
 	{
-		return raw_iterator::operator++(0);
+		std::swap(a.m_data, b.m_data);
+		std::swap(a.m_size, b.m_size);
+		std::swap(a.m_capacity, b.m_capacity);
+		std::swap(a.m_max_size, b.m_max_size);
+		std::swap(a.m_reserved_bytes, b.m_reserved_bytes);
 	}
 
-	template <typename T, typename Allocator, typename ChunkAllocator>
-	constexpr bool stable_vector<T, Allocator, ChunkAllocator>::const_reverse_iterator::operator==(iterator other) const noexcept
+	template <typename T>
+	contiguous_stable_vector<T>::contiguous_stable_vector(std::size_t max_size) : m_data{nullptr}, m_size{0}, m_capacity{0}, m_max_size{max_size}, m_reserved_bytes{0}
 	{
-		return raw_iterator::operator==(other);
+		if (max_size > (std::numeric_limits<std::size_t>::max() - detail::page_size()) / sizeof(T))
+		{
+			throw std::length_error("contiguous_stable_vector: max_size too large");
+		}
+		if (max_size == 0)
+		{
+			return;
+		}
+
+		std::size_t bytes = detail::round_up_to_page(max_size * sizeof(T));
+		m_data = static_cast<T*>(detail::reserve_address_space(bytes));
+		m_reserved_bytes = bytes;
 	}
 
-	template <typename T, typename Allocator, typename ChunkAllocator>
-	constexpr bool stable_vector<T, Allocator, ChunkAllocator>::const_reverse_iterator::operator==(const_iterator other) const noexcept
+	template <typename T>
+	contiguous_stable_vector<T>::contiguous_stable_vector(const contiguous_stable_vector<T>& other) : contiguous_stable_vector{other.m_max_size}
 	{
-		return raw_iterator::operator==(other);
+		reserve(other.m_size);
+		std::uninitialized_copy(other.begin(), other.end(), m_data);
+		m_size = other.m_size;
 	}
 
-	template <typename T, typename Allocator, typename ChunkAllocator>
-	constexpr bool stable_vector<T, Allocator, ChunkAllocator>::const_reverse_iterator::operator==(reverse_iterator other) const noexcept
+	template <typename T>
+	contiguous_stable_vector<T>::contiguous_stable_vector(contiguous_stable_vector<T>&& other) noexcept : m_data{other.m_data}, m_size{other.m_size}, m_capacity{other.m_capacity},
+																											m_max_size{other.m_max_size}, m_reserved_bytes{other.m_reserved_bytes}
 	{
-		return raw_iterator::operator==(other);
+		other.m_data = nullptr;
+		other.m_size = 0;
+		other.m_capacity = 0;
+		other.m_max_size = 0;
+		other.m_reserved_bytes = 0;
 	}
 
-	template <typename T, typename Allocator, typename ChunkAllocator>
-	constexpr bool stable_vector<T, Allocator, ChunkAllocator>::const_reverse_iterator::operator==(const_reverse_iterator other) const noexcept
+	template <typename T>
+	contiguous_stable_vector<T>::~contiguous_stable_vector()
 	{
-		return raw_iterator::operator==(other);
+		if (m_data != nullptr)
+		{
+			std::destroy(m_data, m_data + m_size);
+			::munmap(m_data, m_reserved_bytes);
+		}
 	}
 
-	template <typename T, typename Allocator, typename ChunkAllocator>
-	constexpr stable_vector<T, Allocator, ChunkAllocator>::const_reverse_iterator::reference stable_vector<T, Allocator, ChunkAllocator>::const_reverse_iterator::operator*() noexcept
+	template <typename T>
+	contiguous_stable_vector<T>& contiguous_stable_vector<T>::operator=(contiguous_stable_vector<T> other) noexcept
 	{
-		return raw_iterator::operator*();
+		swap(*this, other);
+		return *this;
 	}
 
-	template <typename T, typename Allocator, typename ChunkAllocator>
-	constexpr stable_vector<T, Allocator, ChunkAllocator>::const_reverse_iterator::pointer stable_vector<T, Allocator, ChunkAllocator>::const_reverse_iterator::operator->() noexcept
+	template <typename T>
+	void contiguous_stable_vector<T>::commit(std::size_t n)
 	{
-		return raw_iterator::operator->();
+		if (n > m_max_size)
+		{
+			throw std::length_error("contiguous_stable_vector: reserved address space exhausted");
+		}
+
+		std::size_t committed_bytes = detail::round_up_to_page(m_capacity * sizeof(T));
+		std::size_t new_bytes = std::min(detail::round_up_to_page(std::max({n * sizeof(T), committed_bytes * 2, min_commit_bytes})), m_reserved_bytes);
+		if (::mprotect(reinterpret_cast<char*>(m_data) + committed_bytes, new_bytes - committed_bytes, PROT_READ | PROT_WRITE) != 0)
+		{
+			throw std::bad_alloc{};
+		}
+		m_capacity = std::min(new_bytes / sizeof(T), m_max_size);
+	}
+
+	template <typename T>
+	template <typename... Args>
+	T& contiguous_stable_vector<T>::emplace_back(Args&&... args)
+	{
+		if (m_size == m_capacity)
+		{
+			commit(m_size + 1);
+		}
+
+		T* elem = std::construct_at(m_data + m_size, std::forward<Args>(args)...);
+		m_size++;
+		return *elem;
+	}
+
+	template <typename T>
+	void contiguous_stable_vector<T>::push_back(const T& val)
+	{
+		emplace_back(val);
+	}
+
+	template <typename T>
+	void contiguous_stable_vector<T>::push_back(T&& val)
+	{
+		emplace_back(std::move(val));
+	}
+
+	template <typename T>
+	void contiguous_stable_vector<T>::pop_back() noexcept
+	{
+		m_size--;
+		std::destroy_at(m_data + m_size);
+	}
+
+	template <typename T>
+	T& contiguous_stable_vector<T>::operator[](std::size_t index) noexcept
+	{
+		return m_data[index];
+	}
+
+	template <typename T>
+	const T& contiguous_stable_vector<T>::operator[](std::size_t index) const noexcept
+	{
+		return m_data[index];
+	}
+
+	template <typename T>
+	T& contiguous_stable_vector<T>::at(std::size_t index)
+	{
+		if (index >= m_size)
+		{
+			throw std::out_of_range("contiguous_stable_vector::at: index out of range");
+		}
+		return m_data[index];
+	}
+
+	template <typename T>
+	const T& contiguous_stable_vector<T>::at(std::size_t index) const
+	{
+		if (index >= m_size)
+		{
+			throw std::out_of_range("contiguous_stable_vector::at: index out of range");
+		}
+		return m_data[index];
+	}
+
+	template <typename T>
+	T* contiguous_stable_vector<T>::data() noexcept
+	{
+		return m_data;
+	}
+
+	template <typename T>
+	const T* contiguous_stable_vector<T>::data() const noexcept
+	{
+		return m_data;
+	}
+
+	template <typename T>
+	std::span<T> contiguous_stable_vector<T>::span() noexcept
+	{
+		return std::span<T>{m_data, m_size};
+	}
+
+	template <typename T>
+	std::span<const T> contiguous_stable_vector<T>::span() const noexcept
+	{
+		return std::span<const T>{m_data, m_size};
+	}
+
+	template <typename T>
+	void contiguous_stable_vector<T>::reserve(std::size_t n)
+	{
+		if (n > m_capacity)
+		{
+			commit(n);
+		}
+	}
+
+	template <typename T>
+	std::size_t contiguous_stable_vector<T>::capacity() const noexcept
+	{
+		return m_capacity;
+	}
+
+	template <typename T>
+	std::size_t contiguous_stable_vector<T>::max_size() const noexcept
+	{
+		return m_max_size;
+	}
+
+	template <typename T>
+	void contiguous_stable_vector<T>::release_unused() noexcept
+	{
+		std::size_t kept_bytes = detail::round_up_to_page(m_size * sizeof(T));
+		std::size_t committed_bytes = detail::round_up_to_page(m_capacity * sizeof(T));
+		if (kept_bytes < committed_bytes)
+		{
+			// MADV_DONTNEED drops the pages; PROT_NONE keeps stray accesses past the end faulting
+			char* first = reinterpret_cast<char*>(m_data) + kept_bytes;
+			::madvise(first, committed_bytes - kept_bytes, MADV_DONTNEED);
+			::mprotect(first, committed_bytes - kept_bytes, PROT_NONE);
+			m_capacity = kept_bytes / sizeof(T);
+		}
+	}
+
+	template <typename T>
+	void contiguous_stable_vector<T>::clear() noexcept
+	{
+		std::destroy(m_data, m_data + m_size);
+		m_size = 0;
+	}
+
+	template <typename T>
+	bool contiguous_stable_vector<T>::empty() const noexcept
+	{
+		return m_size == 0;
+	}
+
+	template <typename T>
+	std::size_t contiguous_stable_vector<T>::size() const noexcept
+	{
+		return m_size;
+	}
+
+	template <typename T>
+	contiguous_stable_vector<T>::iterator contiguous_stable_vector<T>::begin() noexcept
+	{
+		return m_data;
+	}
+
+	template <typename T>
+	contiguous_stable_vector<T>::iterator contiguous_stable_vector<T>::end() noexcept
+	{
+		return m_data + m_size;
+	}
+
+	template <typename T>
+	contiguous_stable_vector<T>::const_iterator contiguous_stable_vector<T>::begin() const noexcept
+	{
+		return m_data;
+	}
+
+	template <typename T>
+	contiguous_stable_vector<T>::const_iterator contiguous_stable_vector<T>::end() const noexcept
+	{
+		return m_data + m_size;
+	}
+
+	template <typename T>
+	contiguous_stable_vector<T>::const_iterator contiguous_stable_vector<T>::cbegin() const noexcept
+	{
+		return m_data;
+	}
+
+	template <typename T>
+	contiguous_stable_vector<T>::const_iterator contiguous_stable_vector<T>::cend() const noexcept
+	{
+		return m_data + m_size;
+	}
+
+	template <typename T>
+	contiguous_stable_vector<T>::reverse_iterator contiguous_stable_vector<T>::rbegin() noexcept
+	{
+		return reverse_iterator{end()};
+	}
+
+	template <typename T>
+	contiguous_stable_vector<T>::reverse_iterator contiguous_stable_vector<T>::rend() noexcept
+	{
+		return reverse_iterator{begin()};
+	}
+
+	template <typename T>
+	contiguous_stable_vector<T>::const_reverse_iterator contiguous_stable_vector<T>::crbegin() const noexcept
+	{
+		return const_reverse_iterator{cend()};
+	}
+
+	template <typename T>
+	contiguous_stable_vector<T>::const_reverse_iterator contiguous_stable_vector<T>::crend() const noexcept
+	{
+		return const_reverse_iterator{cbegin()};
+	}
+
+
+
+	// a contiguous_stable_vector whose elements live in a file: a fixed 64 KiB header followed by the elements. the
+	// file grows with ftruncate plus a MAP_FIXED mapping of the new tail inside the reserved range, so elements
+	// never move, and reopening a file maps it back in place without copying or parsing. the layout does not depend
+	// on the page size, so a file can be reopened on a host with other pages than the one that wrote it. flush()
+	// makes the contents durable with msync; otherwise the kernel writes dirty pages back on its own schedule
+	template <typename T>
+	class mapped_stable_vector
+	{
+		static_assert(std::is_trivially_copyable_v<T>, "mapped elements must be trivially copyable");
+		static_assert(alignof(T) <= 4096, "over-aligned types need more than page alignment");
+
+		public:
+			using value_type = T;
+			using size_type = std::size_t;
+			using difference_type = std::ptrdiff_t;
+			using reference = T&;
+			using const_reference = const T&;
+			using pointer = T*;
+			using const_pointer = const T*;
+			using iterator = T*;
+			using const_iterator = const T*;
+			using reverse_iterator = std::reverse_iterator<iterator>;
+			using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+			static constexpr std::size_t default_reserved_bytes = std::size_t{1} << 36;
+
+		private:
+			struct file_header
+			{
+				std::uint64_t magic;
+				std::uint64_t element_size;
+				std::uint64_t element_alignment;
+				std::uint64_t element_offset;
+				std::uint64_t size;
+			};
+
+			static constexpr std::uint64_t file_magic = 0x3250414d43455653; // "SVECMAP2"
+			// where the elements start in the file, a multiple of every common page size
+			static constexpr std::size_t header_bytes = std::size_t{1} << 16;
+			// the file grows geometrically from this size so ftruncate and mmap calls stay rare
+			static constexpr std::size_t min_grow_bytes = std::size_t{1} << 20;
+
+			int m_fd;
+			// the reserved range; the header is mapped at its start and the elements header_bytes after it
+			char* m_base;
+			std::size_t m_reserved_bytes;
+			// bytes of the file mapped at m_base, which is always the whole file
+			std::size_t m_mapped_bytes;
+			std::size_t m_capacity;
+			std::size_t m_max_size;
+
+			file_header* header() const noexcept;
+			T* elements() const noexcept;
+
+			void map_file(std::size_t file_bytes);
+			void grow(std::size_t n);
+			void release() noexcept;
+
+		public:
+			// opens the file at path, creating it if needed; an existing file must have been written for the same T.
+			// a moved-from container is empty, and growing it throws std::logic_error
+			explicit mapped_stable_vector(const char* path, std::size_t max_size = default_reserved_bytes / sizeof(T));
+			mapped_stable_vector(const mapped_stable_vector<T>& other) = delete;
+			mapped_stable_vector(mapped_stable_vector<T>&& other) noexcept;
+			~mapped_stable_vector();
+
+			mapped_stable_vector<T>& operator=(mapped_stable_vector<T> other) noexcept;
+
+			template <typename... Args>
+			T& emplace_back(Args&&... args);
+			void push_back(const T& val);
+			void pop_back() noexcept;
+
+			T& operator[](std::size_t index) noexcept;
+			const T& operator[](std::size_t index) const noexcept;
+			T& at(std::size_t index);
+			const T& at(std::size_t index) const;
+
+			T* data() noexcept;
+			const T* data() const noexcept;
+			std::span<T> span() noexcept;
+			std::span<const T> span() const noexcept;
+
+			// grows the file to hold n elements; never moves elements
+			void reserve(std::size_t n);
+			std::size_t capacity() const noexcept;
+			std::size_t max_size() const noexcept;
+			// shrinks the file to the pages holding elements
+			void release_unused() noexcept;
+			void clear() noexcept;
+			// blocks until every element and the size are written to the file
+			void flush();
+
+			bool empty() const noexcept;
+			std::size_t size() const noexcept;
+
+			iterator begin() noexcept;
+			iterator end() noexcept;
+			const_iterator begin() const noexcept;
+			const_iterator end() const noexcept;
+			const_iterator cbegin() const noexcept;
+			const_iterator cend() const noexcept;
+
+			reverse_iterator rbegin() noexcept;
+			reverse_iterator rend() noexcept;
+			const_reverse_iterator crbegin() const noexcept;
+			const_reverse_iterator crend() const noexcept;
+
+			template <typename U>
+			friend void swap(mapped_stable_vector<U>& a, mapped_stable_vector<U>& b) noexcept;
+	};
+
+	template <typename T>
+	void swap(mapped_stable_vector<T>& a, mapped_stable_vector<T>& b) noexcept
+	{
+		std::swap(a.m_fd, b.m_fd);
+		std::swap(a.m_base, b.m_base);
+		std::swap(a.m_reserved_bytes, b.m_reserved_bytes);
+		std::swap(a.m_mapped_bytes, b.m_mapped_bytes);
+		std::swap(a.m_capacity, b.m_capacity);
+		std::swap(a.m_max_size, b.m_max_size);
+	}
+
+	template <typename T>
+	mapped_stable_vector<T>::file_header* mapped_stable_vector<T>::header() const noexcept
+	{
+		return reinterpret_cast<file_header*>(m_base);
+	}
+
+	template <typename T>
+	T* mapped_stable_vector<T>::elements() const noexcept
+	{
+		return reinterpret_cast<T*>(m_base + header_bytes);
+	}
+
+	template <typename T>
+	mapped_stable_vector<T>::mapped_stable_vector(const char* path, std::size_t max_size) : m_fd{-1}, m_base{nullptr}, m_reserved_bytes{0}, m_mapped_bytes{0}, m_capacity{0}, m_max_size{max_size}
+	{
+		if (max_size > (std::numeric_limits<std::size_t>::max() - header_bytes - detail::page_size()) / sizeof(T))
+		{
+			throw std::length_error("mapped_stable_vector: max_size too large");
+		}
+
+		m_fd = ::open(path, O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+		if (m_fd == -1)
+		{
+			throw std::system_error(errno, std::generic_category(), "mapped_stable_vector: cannot open file");
+		}
+
+		try
+		{
+			struct stat file_stat;
+			if (::fstat(m_fd, &file_stat) != 0)
+			{
+				throw std::system_error(errno, std::generic_category(), "mapped_stable_vector: cannot stat file");
+			}
+			std::size_t file_bytes = static_cast<std::size_t>(file_stat.st_size);
+
+			m_reserved_bytes = detail::round_up_to_page(header_bytes + max_size * sizeof(T));
+			m_base = static_cast<char*>(detail::reserve_address_space(m_reserved_bytes));
+
+			if (file_bytes == 0)
+			{
+				map_file(header_bytes);
+				*header() = file_header{file_magic, sizeof(T), alignof(T), header_bytes, 0};
+				return;
+			}
+
+			// the file size need not be a multiple of this host's page size, as another host may have written it
+			if (file_bytes < header_bytes)
+			{
+				throw std::runtime_error("mapped_stable_vector: not a stable vector file");
+			}
+			if (file_bytes > m_reserved_bytes)
+			{
+				throw std::length_error("mapped_stable_vector: file holds more than max_size elements");
+			}
+
+			map_file(file_bytes);
+			const file_header& existing = *header();
+			if (existing.magic != file_magic || existing.element_offset != header_bytes)
+			{
+				throw std::runtime_error("mapped_stable_vector: not a stable vector file");
+			}
+			if (existing.element_size != sizeof(T) || existing.element_alignment != alignof(T))
+			{
+				throw std::runtime_error("mapped_stable_vector: file was written for a different element type");
+			}
+			if (existing.size > m_capacity)
+			{
+				throw std::runtime_error("mapped_stable_vector: file is truncated");
+			}
+		}
+		catch (...)
+		{
+			release();
+			throw;
+		}
+	}
+
+	template <typename T>
+	mapped_stable_vector<T>::mapped_stable_vector(mapped_stable_vector<T>&& other) noexcept : m_fd{other.m_fd}, m_base{other.m_base}, m_reserved_bytes{other.m_reserved_bytes},
+																							  m_mapped_bytes{other.m_mapped_bytes}, m_capacity{other.m_capacity}, m_max_size{other.m_max_size}
+	{
+		other.m_fd = -1;
+		other.m_base = nullptr;
+		other.m_reserved_bytes = 0;
+		other.m_mapped_bytes = 0;
+		other.m_capacity = 0;
+		other.m_max_size = 0;
+	}
+
+	template <typename T>
+	mapped_stable_vector<T>::~mapped_stable_vector()
+	{
+		release();
+	}
+
+	template <typename T>
+	mapped_stable_vector<T>& mapped_stable_vector<T>::operator=(mapped_stable_vector<T> other) noexcept
+	{
+		swap(*this, other);
+		return *this;
+	}
+
+	template <typename T>
+	void mapped_stable_vector<T>::map_file(std::size_t file_bytes)
+	{
+		if (::ftruncate(m_fd, static_cast<off_t>(file_bytes)) != 0)
+		{
+			throw std::system_error(errno, std::generic_category(), "mapped_stable_vector: cannot grow file");
+		}
+
+		// a reopened file may end partway into a page; mapping the tail from that page's start keeps the file offset aligned
+		std::size_t mapped_pages_bytes = m_mapped_bytes & ~(detail::page_size() - 1);
+		void* tail = ::mmap(m_base + mapped_pages_bytes, file_bytes - mapped_pages_bytes, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, m_fd, static_cast<off_t>(mapped_pages_bytes));
+		if (tail == MAP_FAILED)
+		{
+			throw std::system_error(errno, std::generic_category(), "mapped_stable_vector: cannot map file");
+		}
+
+		m_mapped_bytes = file_bytes;
+		m_capacity = std::min((file_bytes - header_bytes) / sizeof(T), m_max_size);
+	}
+
+	template <typename T>
+	void mapped_stable_vector<T>::grow(std::size_t n)
+	{
+		if (m_base == nullptr)
+		{
+			throw std::logic_error("mapped_stable_vector: moved-from container has no file");
+		}
+		if (n > m_max_size)
+		{
+			throw std::length_error("mapped_stable_vector: reserved address space exhausted");
+		}
+
+		std::size_t element_bytes = m_mapped_bytes - header_bytes;
+		map_file(std::min(detail::round_up_to_page(header_bytes + std::max({n * sizeof(T), element_bytes * 2, min_grow_bytes})), m_reserved_bytes));
+	}
+
+	template <typename T>
+	void mapped_stable_vector<T>::release() noexcept
+	{
+		if (m_base != nullptr)
+		{
+			::munmap(m_base, m_reserved_bytes);
+			m_base = nullptr;
+		}
+		if (m_fd != -1)
+		{
+			::close(m_fd);
+			m_fd = -1;
+		}
+	}
+
+	template <typename T>
+	template <typename... Args>
+	T& mapped_stable_vector<T>::emplace_back(Args&&... args)
+	{
+		// a moved-from container has no header, and a capacity of 0 sends it to grow, which throws
+		std::size_t size = this->size();
+		if (size == m_capacity)
+		{
+			grow(size + 1);
+		}
+
+		T* elem = std::construct_at(elements() + size, std::forward<Args>(args)...);
+		header()->size = size + 1;
+		return *elem;
+	}
+
+	template <typename T>
+	void mapped_stable_vector<T>::push_back(const T& val)
+	{
+		emplace_back(val);
+	}
+
+	template <typename T>
+	void mapped_stable_vector<T>::pop_back() noexcept
+	{
+		assert(!empty());
+		header()->size--;
+	}
+
+	template <typename T>
+	T& mapped_stable_vector<T>::operator[](std::size_t index) noexcept
+	{
+		return elements()[index];
+	}
+
+	template <typename T>
+	const T& mapped_stable_vector<T>::operator[](std::size_t index) const noexcept
+	{
+		return elements()[index];
+	}
+
+	template <typename T>
+	T& mapped_stable_vector<T>::at(std::size_t index)
+	{
+		if (index >= size())
+		{
+			throw std::out_of_range("mapped_stable_vector::at: index out of range");
+		}
+		return elements()[index];
+	}
+
+	template <typename T>
+	const T& mapped_stable_vector<T>::at(std::size_t index) const
+	{
+		if (index >= size())
+		{
+			throw std::out_of_range("mapped_stable_vector::at: index out of range");
+		}
+		return elements()[index];
+	}
+
+	template <typename T>
+	T* mapped_stable_vector<T>::data() noexcept
+	{
+		return elements();
+	}
+
+	template <typename T>
+	const T* mapped_stable_vector<T>::data() const noexcept
+	{
+		return elements();
+	}
+
+	template <typename T>
+	std::span<T> mapped_stable_vector<T>::span() noexcept
+	{
+		return std::span<T>{elements(), size()};
+	}
+
+	template <typename T>
+	std::span<const T> mapped_stable_vector<T>::span() const noexcept
+	{
+		return std::span<const T>{elements(), size()};
+	}
+
+	template <typename T>
+	void mapped_stable_vector<T>::reserve(std::size_t n)
+	{
+		if (n > m_capacity)
+		{
+			grow(n);
+		}
+	}
+
+	template <typename T>
+	std::size_t mapped_stable_vector<T>::capacity() const noexcept
+	{
+		return m_capacity;
+	}
+
+	template <typename T>
+	std::size_t mapped_stable_vector<T>::max_size() const noexcept
+	{
+		return m_max_size;
+	}
+
+	template <typename T>
+	void mapped_stable_vector<T>::release_unused() noexcept
+	{
+		std::size_t kept_bytes = detail::round_up_to_page(header_bytes + size() * sizeof(T));
+		if (kept_bytes >= m_mapped_bytes)
+		{
+			return;
+		}
+
+		// put the reservation back over the dropped tail before cutting the file, so nothing else can be mapped there
+		void* tail = ::mmap(m_base + kept_bytes, m_mapped_bytes - kept_bytes, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE | MAP_FIXED, -1, 0);
+		if (tail == MAP_FAILED)
+		{
+			return;
+		}
+		m_mapped_bytes = kept_bytes;
+		m_capacity = std::min((kept_bytes - header_bytes) / sizeof(T), m_max_size);
+		// a failed truncation only leaves unused bytes at the end of the file, which reopening ignores
+		static_cast<void>(::ftruncate(m_fd, static_cast<off_t>(kept_bytes)));
+	}
+
+	template <typename T>
+	void mapped_stable_vector<T>::clear() noexcept
+	{
+		if (m_base != nullptr)
+		{
+			header()->size = 0;
+		}
+	}
+
+	template <typename T>
+	void mapped_stable_vector<T>::flush()
+	{
+		if (::msync(m_base, m_mapped_bytes, MS_SYNC) != 0)
+		{
+			throw std::system_error(errno, std::generic_category(), "mapped_stable_vector: cannot flush file");
+		}
+	}
+
+	template <typename T>
+	bool mapped_stable_vector<T>::empty() const noexcept
+	{
+		return size() == 0;
+	}
+
+	template <typename T>
+	std::size_t mapped_stable_vector<T>::size() const noexcept
+	{
+		// a moved-from container has no header
+		return m_base == nullptr ? 0 : header()->size;
+	}
+
+	template <typename T>
+	mapped_stable_vector<T>::iterator mapped_stable_vector<T>::begin() noexcept
+	{
+		return elements();
+	}
+
+	template <typename T>
+	mapped_stable_vector<T>::iterator mapped_stable_vector<T>::end() noexcept
+	{
+		return elements() + size();
+	}
+
+	template <typename T>
+	mapped_stable_vector<T>::const_iterator mapped_stable_vector<T>::begin() const noexcept
+	{
+		return elements();
+	}
+
+	template <typename T>
+	mapped_stable_vector<T>::const_iterator mapped_stable_vector<T>::end() const noexcept
+	{
+		return elements() + size();
+	}
+
+	template <typename T>
+	mapped_stable_vector<T>::const_iterator mapped_stable_vector<T>::cbegin() const noexcept
+	{
+		return elements();
+	}
+
+	template <typename T>
+	mapped_stable_vector<T>::const_iterator mapped_stable_vector<T>::cend() const noexcept
+	{
+		return elements() + size();
+	}
+
+	template <typename T>
+	mapped_stable_vector<T>::reverse_iterator mapped_stable_vector<T>::rbegin() noexcept
+	{
+		return reverse_iterator{end()};
+	}
+
+	template <typename T>
+	mapped_stable_vector<T>::reverse_iterator mapped_stable_vector<T>::rend() noexcept
+	{
+		return reverse_iterator{begin()};
+	}
+
+	template <typename T>
+	mapped_stable_vector<T>::const_reverse_iterator mapped_stable_vector<T>::crbegin() const noexcept
+	{
+		return const_reverse_iterator{cend()};
+	}
+
+	template <typename T>
+	mapped_stable_vector<T>::const_reverse_iterator mapped_stable_vector<T>::crend() const noexcept
+	{
+		return const_reverse_iterator{cbegin()};
+	}
+#endif
+
+
+
+
+
+
+	// an unordered container whose elements never move, in the style of std::hive: erase() leaves a hole that iteration
+	// jumps over in O(1) and a later insert fills again. every chunk keeps a jump-counting skip field, where the first and
+	// last slot of each run of erased slots hold the run's length and live slots hold 0, and links its runs into a free
+	// list threaded through the erased slots themselves
+	template <typename T, typename Allocator = std::allocator<T>>
+	class stable_hive
+	{
+		private:
+			using skip_type = std::uint16_t;
+
+			template <bool Const>
+			class basic_iterator;
+
+		public:
+			using value_type = T;
+			using allocator_type = Allocator;
+			using size_type = std::size_t;
+			using difference_type = std::ptrdiff_t;
+			using reference = T&;
+			using const_reference = const T&;
+			using pointer = T*;
+			using const_pointer = const T*;
+			using iterator = basic_iterator<false>;
+			using const_iterator = basic_iterator<true>;
+
+		private:
+			static constexpr skip_type no_slot = std::numeric_limits<skip_type>::max();
+			static constexpr std::size_t no_chunk = std::numeric_limits<std::size_t>::max();
+			// chunk capacity doubles with the total from the minimum up to the maximum, which skip_type must be able to count
+			static constexpr std::size_t min_chunk_capacity = 16;
+			static constexpr std::size_t max_chunk_capacity = 8192;
+
+			// the free list node an erased slot holds in place of its element
+			struct free_run
+			{
+				skip_type prev;
+				skip_type next;
+			};
+
+			union slot
+			{
+				T value;
+				free_run run;
+
+				slot() noexcept {}
+				~slot() {}
+			};
+
+			struct chunk
+			{
+				slot* slots;
+				skip_type* skips;
+				std::size_t capacity;
+				// slots below end have held an element at some point; size counts the live ones
+				std::size_t end;
+				std::size_t size;
+				// first slot of the first erased run, and this chunk's neighbours in the list of chunks with erased slots
+				skip_type free_head;
+				std::size_t prev_free;
+				std::size_t next_free;
+			};
+
+			using slot_allocator = typename std::allocator_traits<Allocator>::template rebind_alloc<slot>;
+			using skip_allocator = typename std::allocator_traits<Allocator>::template rebind_alloc<skip_type>;
+			using chunk_directory = std::vector<chunk, typename std::allocator_traits<Allocator>::template rebind_alloc<chunk>>;
+			using chunk_order = std::vector<std::size_t, typename std::allocator_traits<Allocator>::template rebind_alloc<std::size_t>>;
+
+			Allocator m_allocator;
+			chunk_directory m_chunks;
+			// chunk indices sorted by the address of their slots, so get_iterator finds an element's chunk by binary search
+			chunk_order m_chunks_by_address;
+			std::size_t m_size;
+			std::size_t m_capacity;
+			// head of the list of chunks with erased slots, where inserts go first
+			std::size_t m_free_chunks;
+
+			void push_chunk();
+			void free_chunks() noexcept;
+			// exchanges contents but not allocators
+			void swap_storage(stable_hive<T, Allocator>& other) noexcept;
+			void link_free_chunk(std::size_t chunk_index) noexcept;
+			void unlink_free_chunk(std::size_t chunk_index) noexcept;
+			void reuse_slot(std::size_t chunk_index, free_run run) noexcept;
+			void release_slot(std::size_t chunk_index, std::size_t slot_index) noexcept;
+			// moves (chunk_index, slot_index) forward onto the next live slot, or onto end(); slot_index must be live,
+			// the first slot of an erased run, or the end of its chunk
+			void skip_to_live(std::size_t& chunk_index, std::size_t& slot_index) const noexcept;
+
+			template <bool Const>
+			class basic_iterator
+			{
+				public:
+					using iterator_category = std::bidirectional_iterator_tag;
+					using iterator_concept = std::bidirectional_iterator_tag;
+					using value_type = T;
+					using difference_type = std::ptrdiff_t;
+					using pointer = std::conditional_t<Const, const T*, T*>;
+					using reference = std::conditional_t<Const, const T&, T&>;
+
+				private:
+					using hive_pointer = std::conditional_t<Const, const stable_hive<T, Allocator>*, stable_hive<T, Allocator>*>;
+
+					hive_pointer m_hive;
+					std::size_t m_chunk_index;
+					std::size_t m_slot_index;
+
+				public:
+					basic_iterator() noexcept;
+					basic_iterator(hive_pointer hive, std::size_t chunk_index, std::size_t slot_index) noexcept;
+
+					operator basic_iterator<true>() const noexcept requires (!Const);
+
+					basic_iterator& operator++() noexcept;
+					basic_iterator operator++(int) noexcept;
+					basic_iterator& operator--() noexcept;
+					basic_iterator operator--(int) noexcept;
+
+					reference operator*() const noexcept;
+					pointer operator->() const noexcept;
+
+					friend bool operator==(const basic_iterator& a, const basic_iterator& b) noexcept
+					{
+						return a.m_chunk_index == b.m_chunk_index && a.m_slot_index == b.m_slot_index;
+					}
+
+					friend class stable_hive<T, Allocator>;
+			};
+
+		public:
+			stable_hive();
+			explicit stable_hive(const Allocator& allocator);
+			stable_hive(const stable_hive<T, Allocator>& other);
+			stable_hive(stable_hive<T, Allocator>&& other) noexcept;
+			~stable_hive();
+
+			stable_hive<T, Allocator>& operator=(stable_hive<T, Allocator> other);
+
+			Allocator get_allocator() const noexcept;
+
+			// reuses an erased slot when there is one, otherwise appends to the last chunk
+			template <typename... Args>
+			iterator emplace(Args&&... args);
+			iterator insert(const T& val);
+			iterator insert(T&& val);
+			// destroys one element and returns the next one; every other element keeps its address
+			iterator erase(const_iterator pos) noexcept;
+			// the iterator for an element of this container in O(log chunks), or end() for an erased slot or a foreign pointer
+			iterator get_iterator(const T* elem) noexcept;
+			const_iterator get_iterator(const T* elem) const noexcept;
+			void clear() noexcept;
+
+			bool empty() const noexcept;
+			std::size_t size() const noexcept;
+			std::size_t capacity() const noexcept;
+
+			iterator begin() noexcept;
+			iterator end() noexcept;
+			const_iterator begin() const noexcept;
+			const_iterator end() const noexcept;
+			const_iterator cbegin() const noexcept;
+			const_iterator cend() const noexcept;
+
+			template <typename U, typename SwapAllocator>
+			friend void swap(stable_hive<U, SwapAllocator>& a, stable_hive<U, SwapAllocator>& b) noexcept;
+	};
+
+	template <typename T, typename Allocator>
+	void swap(stable_hive<T, Allocator>& a, stable_hive<T, Allocator>& b) noexcept
+	{
+		// as with the standard containers, allocators that do not propagate on swap have to be equal
+		if constexpr (std::allocator_traits<Allocator>::propagate_on_container_swap::value)
+		{
+			using std::swap;
+			swap(a.m_allocator, b.m_allocator);
+		}
+		else
+		{
+			assert(a.m_allocator == b.m_allocator);
+		}
+		a.swap_storage(b);
+	}
+
+	template <typename T, typename Allocator>
+	stable_hive<T, Allocator>::stable_hive() : stable_hive{Allocator{}}  {}
+
+	template <typename T, typename Allocator>
+	stable_hive<T, Allocator>::stable_hive(const Allocator& allocator) : m_allocator{allocator}, m_chunks(typename chunk_directory::allocator_type(allocator)),
+																					  m_chunks_by_address(typename chunk_order::allocator_type(allocator)), m_size{0}, m_capacity{0}, m_free_chunks{no_chunk}  {}
+
+	template <typename T, typename Allocator>
+	stable_hive<T, Allocator>::stable_hive(const stable_hive<T, Allocator>& other) : stable_hive{std::allocator_traits<Allocator>::select_on_container_copy_construction(other.m_allocator)}
+	{
+		// the copy is compact: holes in other are not reproduced
+		for (const T& elem : other)
+		{
+			emplace(elem);
+		}
+	}
+
+	template <typename T, typename Allocator>
+	stable_hive<T, Allocator>::stable_hive(stable_hive<T, Allocator>&& other) noexcept : m_allocator{other.m_allocator}, m_chunks{std::move(other.m_chunks)},
+																						   m_chunks_by_address{std::move(other.m_chunks_by_address)}, m_size{other.m_size},
+																						   m_capacity{other.m_capacity}, m_free_chunks{other.m_free_chunks}
+	{
+		other.m_chunks.clear();
+		other.m_chunks_by_address.clear();
+		other.m_size = 0;
+		other.m_capacity = 0;
+		other.m_free_chunks = no_chunk;
+	}
+
+	template <typename T, typename Allocator>
+	stable_hive<T, Allocator>::~stable_hive()
+	{
+		free_chunks();
+	}
+
+	template <typename T, typename Allocator>
+	stable_hive<T, Allocator>& stable_hive<T, Allocator>::operator=(stable_hive<T, Allocator> other)
+	{
+		// other's chunks can only be taken along with its allocator, or when ours can free them
+		if constexpr (std::allocator_traits<Allocator>::propagate_on_container_move_assignment::value)
+		{
+			using std::swap;
+			swap(m_allocator, other.m_allocator);
+			swap_storage(other);
+		}
+		else if (m_allocator == other.m_allocator)
+		{
+			swap_storage(other);
+		}
+		else
+		{
+			clear();
+			for (T& elem : other)
+			{
+				emplace(std::move(elem));
+			}
+		}
+		return *this;
+	}
+
+	template <typename T, typename Allocator>
+	void stable_hive<T, Allocator>::swap_storage(stable_hive<T, Allocator>& other) noexcept
+	{
+		std::swap(m_chunks, other.m_chunks);
+		std::swap(m_chunks_by_address, other.m_chunks_by_address);
+		std::swap(m_size, other.m_size);
+		std::swap(m_capacity, other.m_capacity);
+		std::swap(m_free_chunks, other.m_free_chunks);
+	}
+
+	template <typename T, typename Allocator>
+	Allocator stable_hive<T, Allocator>::get_allocator() const noexcept
+	{
+		return m_allocator;
+	}
+
+	template <typename T, typename Allocator>
+	void stable_hive<T, Allocator>::push_chunk()
+	{
+		std::size_t capacity = std::clamp(m_capacity, min_chunk_capacity, max_chunk_capacity);
+
+		slot_allocator slot_alloc(m_allocator);
+		skip_allocator skip_alloc(m_allocator);
+		slot* slots = std::allocator_traits<slot_allocator>::allocate(slot_alloc, capacity);
+		skip_type* skips = nullptr;
+		try
+		{
+			skips = std::allocator_traits<skip_allocator>::allocate(skip_alloc, capacity);
+			m_chunks_by_address.reserve(m_chunks.size() + 1);
+			m_chunks.push_back(chunk{slots, skips, capacity, 0, 0, no_slot, no_chunk, no_chunk});
+		}
+		catch (...)
+		{
+			if (skips != nullptr)
+			{
+				std::allocator_traits<skip_allocator>::deallocate(skip_alloc, skips, capacity);
+			}
+			std::allocator_traits<slot_allocator>::deallocate(slot_alloc, slots, capacity);
+			throw;
+		}
+
+		// room was reserved above, so this insert can't throw
+		auto position = std::upper_bound(m_chunks_by_address.begin(), m_chunks_by_address.end(), slots, [this](const slot* first, std::size_t chunk_index)
+		{
+			return std::less<const slot*>{}(first, m_chunks[chunk_index].slots);
+		});
+		m_chunks_by_address.insert(position, m_chunks.size() - 1);
+
+		std::fill_n(skips, capacity, skip_type{0});
+		m_capacity += capacity;
+	}
+
+	template <typename T, typename Allocator>
+	void stable_hive<T, Allocator>::free_chunks() noexcept
+	{
+		slot_allocator slot_alloc(m_allocator);
+		skip_allocator skip_alloc(m_allocator);
+		for (std::size_t chunk_index = 0; chunk_index < m_chunks.size(); chunk_index++)
+		{
+			chunk& current_chunk = m_chunks[chunk_index];
+			std::size_t slot_index = 0;
+			std::size_t current_index = chunk_index;
+			skip_to_live(current_index, slot_index);
+			while (current_index == chunk_index)
+			{
+				std::allocator_traits<Allocator>::destroy(m_allocator, std::addressof(current_chunk.slots[slot_index].value));
+				slot_index++;
+				skip_to_live(current_index, slot_index);
+			}
+
+			std::allocator_traits<skip_allocator>::deallocate(skip_alloc, current_chunk.skips, current_chunk.capacity);
+			std::allocator_traits<slot_allocator>::deallocate(slot_alloc, current_chunk.slots, current_chunk.capacity);
+		}
+		m_chunks.clear();
+		m_chunks_by_address.clear();
+		m_size = 0;
+		m_capacity = 0;
+		m_free_chunks = no_chunk;
+	}
+
+	template <typename T, typename Allocator>
+	void stable_hive<T, Allocator>::link_free_chunk(std::size_t chunk_index) noexcept
+	{
+		chunk& current_chunk = m_chunks[chunk_index];
+		current_chunk.prev_free = no_chunk;
+		current_chunk.next_free = m_free_chunks;
+		if (m_free_chunks != no_chunk)
+		{
+			m_chunks[m_free_chunks].prev_free = chunk_index;
+		}
+		m_free_chunks = chunk_index;
+	}
+
+	template <typename T, typename Allocator>
+	void stable_hive<T, Allocator>::unlink_free_chunk(std::size_t chunk_index) noexcept
+	{
+		chunk& current_chunk = m_chunks[chunk_index];
+		if (current_chunk.prev_free != no_chunk)
+		{
+			m_chunks[current_chunk.prev_free].next_free = current_chunk.next_free;
+		}
+		else
+		{
+			m_free_chunks = current_chunk.next_free;
+		}
+		if (current_chunk.next_free != no_chunk)
+		{
+			m_chunks[current_chunk.next_free].prev_free = current_chunk.prev_free;
+		}
+	}
+
+	template <typename T, typename Allocator>
+	void stable_hive<T, Allocator>::reuse_slot(std::size_t chunk_index, free_run run) noexcept
+	{
+		// the chunk's first run just lost its first slot to a new element; run is the free list node that slot held
+		chunk& current_chunk = m_chunks[chunk_index];
+		std::size_t start = current_chunk.free_head;
+		std::size_t length = current_chunk.skips[start];
+		current_chunk.skips[start] = 0;
+
+		if (length == 1)
+		{
+			current_chunk.free_head = run.next;
+			if (run.next != no_slot)
+			{
+				current_chunk.slots[run.next].run.prev = no_slot;
+			}
+			else
+			{
+				unlink_free_chunk(chunk_index);
+			}
+		}
+		else
+		{
+			std::size_t new_start = start + 1;
+			current_chunk.skips[new_start] = static_cast<skip_type>(length - 1);
+			current_chunk.skips[start + length - 1] = static_cast<skip_type>(length - 1);
+
+			std::construct_at(std::addressof(current_chunk.slots[new_start].run), run);
+			current_chunk.free_head = static_cast<skip_type>(new_start);
+			if (run.next != no_slot)
+			{
+				current_chunk.slots[run.next].run.prev = static_cast<skip_type>(new_start);
+			}
+		}
+	}
+
+	template <typename T, typename Allocator>
+	void stable_hive<T, Allocator>::release_slot(std::size_t chunk_index, std::size_t slot_index) noexcept
+	{
+		// slot_index was just vacated; it joins the erased runs next to it, or starts a run of its own
+		chunk& current_chunk = m_chunks[chunk_index];
+		skip_type* skips = current_chunk.skips;
+		slot* slots = current_chunk.slots;
+		bool had_free_runs = current_chunk.free_head != no_slot;
+
+		std::size_t left = slot_index > 0 ? skips[slot_index - 1] : 0;
+		std::size_t right = slot_index + 1 < current_chunk.end ? skips[slot_index + 1] : 0;
+		std::size_t start = slot_index - left;
+		std::size_t last = slot_index + right;
+		skip_type length = static_cast<skip_type>(left + right + 1);
+
+		// only a run's first and last slot need its length, but slots inside a run must stay nonzero
+		skips[start] = length;
+		skips[slot_index] = length;
+		skips[last] = length;
+
+		if (left == 0 && right == 0)
+		{
+			std::construct_at(std::addressof(slots[slot_index].run), free_run{no_slot, current_chunk.free_head});
+			if (current_chunk.free_head != no_slot)
+			{
+				slots[current_chunk.free_head].run.prev = static_cast<skip_type>(slot_index);
+			}
+			current_chunk.free_head = static_cast<skip_type>(slot_index);
+		}
+		else if (right != 0)
+		{
+			// the run on the right loses its free list node: it moves to slot_index when slot_index starts the merged
+			// run, and is unlinked when the run on the left already has one
+			free_run run = slots[slot_index + 1].run;
+			if (left == 0)
+			{
+				std::construct_at(std::addressof(slots[slot_index].run), run);
+			}
+			skip_type replacement = left == 0 ? static_cast<skip_type>(slot_index) : run.next;
+
+			if (run.prev != no_slot)
+			{
+				slots[run.prev].run.next = replacement;
+			}
+			else
+			{
+				current_chunk.free_head = replacement;
+			}
+			if (run.next != no_slot)
+			{
+				slots[run.next].run.prev = left == 0 ? static_cast<skip_type>(slot_index) : run.prev;
+			}
+		}
+
+		if (!had_free_runs)
+		{
+			link_free_chunk(chunk_index);
+		}
+	}
+
+	template <typename T, typename Allocator>
+	void stable_hive<T, Allocator>::skip_to_live(std::size_t& chunk_index, std::size_t& slot_index) const noexcept
+	{
+		while (chunk_index < m_chunks.size())
+		{
+			const chunk& current_chunk = m_chunks[chunk_index];
+			if (slot_index < current_chunk.end)
+			{
+				slot_index += current_chunk.skips[slot_index];
+				if (slot_index < current_chunk.end)
+				{
+					return;
+				}
+			}
+			chunk_index++;
+			slot_index = 0;
+		}
+		slot_index = 0;
+	}
+
+	template <typename T, typename Allocator>
+	template <typename... Args>
+	stable_hive<T, Allocator>::iterator stable_hive<T, Allocator>::emplace(Args&&... args)
+	{
+		std::size_t chunk_index;
+		std::size_t slot_index;
+
+		if (m_free_chunks != no_chunk)
+		{
+			chunk_index = m_free_chunks;
+			chunk& current_chunk = m_chunks[chunk_index];
+			slot_index = current_chunk.free_head;
+
+			// constructing the element overwrites the free list node, so keep a copy to restore on failure
+			free_run run = current_chunk.slots[slot_index].run;
+			try { std::allocator_traits<Allocator>::construct(m_allocator, std::addressof(current_chunk.slots[slot_index].value), std::forward<Args>(args)...); }
+			catch (...)
+			{
+				std::construct_at(std::addressof(current_chunk.slots[slot_index].run), run);
+				throw;
+			}
+			reuse_slot(chunk_index, run);
+		}
+		else
+		{
+			if (m_chunks.empty() || m_chunks.back().end == m_chunks.back().capacity)
+			{
+				push_chunk();
+			}
+			chunk_index = m_chunks.size() - 1;
+			chunk& current_chunk = m_chunks.back();
+			slot_index = current_chunk.end;
+
+			std::allocator_traits<Allocator>::construct(m_allocator, std::addressof(current_chunk.slots[slot_index].value), std::forward<Args>(args)...);
+			current_chunk.end++;
+		}
+
+		m_chunks[chunk_index].size++;
+		m_size++;
+		return iterator{this, chunk_index, slot_index};
+	}
+
+	template <typename T, typename Allocator>
+	stable_hive<T, Allocator>::iterator stable_hive<T, Allocator>::insert(const T& val)
+	{
+		return emplace(val);
+	}
+
+	template <typename T, typename Allocator>
+	stable_hive<T, Allocator>::iterator stable_hive<T, Allocator>::insert(T&& val)
+	{
+		return emplace(std::move(val));
+	}
+
+	template <typename T, typename Allocator>
+	stable_hive<T, Allocator>::iterator stable_hive<T, Allocator>::erase(const_iterator pos) noexcept
+	{
+		std::size_t chunk_index = pos.m_chunk_index;
+		std::size_t slot_index = pos.m_slot_index;
+		chunk& current_chunk = m_chunks[chunk_index];
+
+		// the next element follows the erased run on the right, if any
+		std::size_t next_index = slot_index + 1;
+		if (next_index < current_chunk.end)
+		{
+			next_index += current_chunk.skips[next_index];
+		}
+
+		std::allocator_traits<Allocator>::destroy(m_allocator, std::addressof(current_chunk.slots[slot_index].value));
+		release_slot(chunk_index, slot_index);
+		current_chunk.size--;
+		m_size--;
+
+		skip_to_live(chunk_index, next_index);
+		return iterator{this, chunk_index, next_index};
+	}
+
+	template <typename T, typename Allocator>
+	stable_hive<T, Allocator>::iterator stable_hive<T, Allocator>::get_iterator(const T* elem) noexcept
+	{
+		const_iterator pos = std::as_const(*this).get_iterator(elem);
+		return iterator{this, pos.m_chunk_index, pos.m_slot_index};
+	}
+
+	template <typename T, typename Allocator>
+	stable_hive<T, Allocator>::const_iterator stable_hive<T, Allocator>::get_iterator(const T* elem) const noexcept
+	{
+		// an element shares its address with the slot holding it, but a slot can be larger than T, so count in slots
+		const slot* elem_slot = reinterpret_cast<const slot*>(elem);
+
+		// only the last chunk starting at or below elem can hold it
+		auto after = std::upper_bound(m_chunks_by_address.begin(), m_chunks_by_address.end(), elem_slot, [this](const slot* first, std::size_t chunk_index)
+		{
+			return std::less<const slot*>{}(first, m_chunks[chunk_index].slots);
+		});
+		if (after != m_chunks_by_address.begin())
+		{
+			std::size_t chunk_index = *std::prev(after);
+			const chunk& current_chunk = m_chunks[chunk_index];
+			const slot* first = current_chunk.slots;
+			if (std::less<const slot*>{}(elem_slot, first + current_chunk.end))
+			{
+				// erased slots carry their run's length in the skip field, live ones 0
+				std::size_t slot_index = static_cast<std::size_t>(elem_slot - first);
+				if (current_chunk.skips[slot_index] == 0)
+				{
+					return const_iterator{this, chunk_index, slot_index};
+				}
+			}
+		}
+		return end();
+	}
+
+	template <typename T, typename Allocator>
+	void stable_hive<T, Allocator>::clear() noexcept
+	{
+		free_chunks();
+	}
+
+	template <typename T, typename Allocator>
+	bool stable_hive<T, Allocator>::empty() const noexcept
+	{
+		return m_size == 0;
+	}
+
+	template <typename T, typename Allocator>
+	std::size_t stable_hive<T, Allocator>::size() const noexcept
+	{
+		return m_size;
+	}
+
+	template <typename T, typename Allocator>
+	std::size_t stable_hive<T, Allocator>::capacity() const noexcept
+	{
+		return m_capacity;
+	}
+
+	template <typename T, typename Allocator>
+	stable_hive<T, Allocator>::iterator stable_hive<T, Allocator>::begin() noexcept
+	{
+		std::size_t chunk_index = 0;
+		std::size_t slot_index = 0;
+		skip_to_live(chunk_index, slot_index);
+		return iterator{this, chunk_index, slot_index};
+	}
+
+	template <typename T, typename Allocator>
+	stable_hive<T, Allocator>::iterator stable_hive<T, Allocator>::end() noexcept
+	{
+		return iterator{this, m_chunks.size(), 0};
+	}
+
+	template <typename T, typename Allocator>
+	stable_hive<T, Allocator>::const_iterator stable_hive<T, Allocator>::begin() const noexcept
+	{
+		return cbegin();
+	}
+
+	template <typename T, typename Allocator>
+	stable_hive<T, Allocator>::const_iterator stable_hive<T, Allocator>::end() const noexcept
+	{
+		return cend();
+	}
+
+	template <typename T, typename Allocator>
+	stable_hive<T, Allocator>::const_iterator stable_hive<T, Allocator>::cbegin() const noexcept
+	{
+		std::size_t chunk_index = 0;
+		std::size_t slot_index = 0;
+		skip_to_live(chunk_index, slot_index);
+		return const_iterator{this, chunk_index, slot_index};
+	}
+
+	template <typename T, typename Allocator>
+	stable_hive<T, Allocator>::const_iterator stable_hive<T, Allocator>::cend() const noexcept
+	{
+		return const_iterator{this, m_chunks.size(), 0};
+	}
+
+	template <typename T, typename Allocator>
+	template <bool Const>
+	stable_hive<T, Allocator>::basic_iterator<Const>::basic_iterator() noexcept : m_hive{nullptr}, m_chunk_index{0}, m_slot_index{0}  {}
+
+	template <typename T, typename Allocator>
+	template <bool Const>
+	stable_hive<T, Allocator>::basic_iterator<Const>::basic_iterator(hive_pointer hive, std::size_t chunk_index, std::size_t slot_index) noexcept : m_hive{hive}, m_chunk_index{chunk_index}, m_slot_index{slot_index}  {}
+
+	template <typename T, typename Allocator>
+	template <bool Const>
+	stable_hive<T, Allocator>::basic_iterator<Const>::operator basic_iterator<true>() const noexcept requires (!Const)
+	{
+		return basic_iterator<true>{m_hive, m_chunk_index, m_slot_index};
+	}
+
+	template <typename T, typename Allocator>
+	template <bool Const>
+	stable_hive<T, Allocator>::basic_iterator<Const>& stable_hive<T, Allocator>::basic_iterator<Const>::operator++() noexcept
+	{
+		m_slot_index++;
+		m_hive->skip_to_live(m_chunk_index, m_slot_index);
+		return *this;
+	}
+
+	template <typename T, typename Allocator>
+	template <bool Const>
+	stable_hive<T, Allocator>::basic_iterator<Const> stable_hive<T, Allocator>::basic_iterator<Const>::operator++(int) noexcept
+	{
+		basic_iterator<Const> old = *this;
+		++(*this);
+		return old;
+	}
+
+	template <typename T, typename Allocator>
+	template <bool Const>
+	stable_hive<T, Allocator>::basic_iterator<Const>& stable_hive<T, Allocator>::basic_iterator<Const>::operator--() noexcept
+	{
+		// the slot before a live one is live or the last slot of an erased run, which holds the run's length
+		std::size_t chunk_index = m_chunk_index;
+		std::size_t slot_index = chunk_index < m_hive->m_chunks.size() ? m_slot_index : 0;
+		while (true)
+		{
+			if (slot_index > 0)
+			{
+				std::size_t skip = m_hive->m_chunks[chunk_index].skips[slot_index - 1];
+				if (skip < slot_index)
+				{
+					m_chunk_index = chunk_index;
+					m_slot_index = slot_index - skip - 1;
+					return *this;
+				}
+			}
+			chunk_index--;
+			slot_index = m_hive->m_chunks[chunk_index].end;
+		}
+	}
+
+	template <typename T, typename Allocator>
+	template <bool Const>
+	stable_hive<T, Allocator>::basic_iterator<Const> stable_hive<T, Allocator>::basic_iterator<Const>::operator--(int) noexcept
+	{
+		basic_iterator<Const> old = *this;
+		--(*this);
+		return old;
+	}
+
+	template <typename T, typename Allocator>
+	template <bool Const>
+	stable_hive<T, Allocator>::basic_iterator<Const>::reference stable_hive<T, Allocator>::basic_iterator<Const>::operator*() const noexcept
+	{
+		return m_hive->m_chunks[m_chunk_index].slots[m_slot_index].value;
+	}
+
+	template <typename T, typename Allocator>
+	template <bool Const>
+	stable_hive<T, Allocator>::basic_iterator<Const>::pointer stable_hive<T, Allocator>::basic_iterator<Const>::operator->() const noexcept
+	{
+		return std::addressof(**this);
+	}
+
+	namespace pmr
+	{
+		template <typename T>
+		using stable_hive = my_adt::stable_hive<T, std::pmr::polymorphic_allocator<T>>;
+	}
+
+
+
+
+
+
+	// names an element of a slot_map; a handle whose element was erased stops resolving, even once its slot is reused
+	struct slot_map_handle
+	{
+		std::uint32_t index = 0;
+		std::uint32_t generation = 0;
+
+		friend bool operator==(const slot_map_handle& a, const slot_map_handle& b) noexcept = default;
+	};
+
+	// elements live densely in a stable_vector, so iterating them is a scan over contiguous chunks, while handles go through
+	// a slot table that maps them to dense positions in O(1). a slot's generation is odd while it holds an element and even
+	// once that element is erased, so one compare rejects stale handles. inserts never move elements; erase moves the last
+	// element into the hole, which invalidates pointers to that element but not its handle
+	template <typename T>
+	class slot_map
+	{
+		private:
+			struct slot
+			{
+				// the element's dense position while the slot is in use, the next free slot otherwise
+				std::uint32_t position;
+				std::uint32_t generation;
+				// the element itself, so a lookup costs one slot load instead of a chunk search
+				T* value;
+			};
+
+			static constexpr std::uint32_t no_slot = std::numeric_limits<std::uint32_t>::max();
+			// a slot erased at this generation is retired instead of reused, so generations never wrap around
+			static constexpr std::uint32_t retired_generation = std::numeric_limits<std::uint32_t>::max() - 1;
+
+			stable_vector<T> m_values;
+			// the slot of each dense position, used by erase to repoint the element it moves
+			stable_vector<std::uint32_t> m_value_slots;
+			std::vector<slot> m_slots;
+			std::uint32_t m_free_head;
+
+			// points every live slot at its element in m_values, after a copy has left them pointing into the source
+			void repoint_slots() noexcept;
+
+		public:
+			using value_type = T;
+			using handle = slot_map_handle;
+			using iterator = typename stable_vector<T>::iterator;
+			using const_iterator = typename stable_vector<T>::const_iterator;
+
+			slot_map();
+			slot_map(const slot_map& other);
+			// leaves other empty and ready for reuse
+			slot_map(slot_map&& other) noexcept;
+			slot_map& operator=(const slot_map& other);
+			slot_map& operator=(slot_map&& other) noexcept;
+
+			template <typename... Args>
+			handle emplace(Args&&... args);
+			handle insert(const T& val);
+			handle insert(T&& val);
+			// returns false for a stale handle; requires T to be move assignable
+			bool erase(handle h);
+			void clear();
+
+			// nullptr for a stale handle
+			T* find(handle h) noexcept;
+			const T* find(handle h) const noexcept;
+			bool contains(handle h) const noexcept;
+			T& at(handle h);
+			const T& at(handle h) const;
+			// h must be live
+			T& operator[](handle h) noexcept;
+			const T& operator[](handle h) const noexcept;
+			// the handle of the element at a dense position, e.g. while iterating
+			handle handle_at(std::size_t position) const noexcept;
+
+			void reserve(std::size_t n);
+			bool empty() const noexcept;
+			std::size_t size() const noexcept;
+
+			iterator begin() noexcept;
+			iterator end() noexcept;
+			const_iterator begin() const noexcept;
+			const_iterator end() const noexcept;
+			const_iterator cbegin() const noexcept;
+			const_iterator cend() const noexcept;
+
+			auto segments() noexcept;
+			auto segments() const noexcept;
+	};
+
+	template <typename T>
+	slot_map<T>::slot_map() : m_values{}, m_value_slots{}, m_slots{}, m_free_head{no_slot}  {}
+
+	template <typename T>
+	slot_map<T>::slot_map(const slot_map& other) : m_values{other.m_values}, m_value_slots{other.m_value_slots}, m_slots{other.m_slots}, m_free_head{other.m_free_head}
+	{
+		repoint_slots();
+	}
+
+	template <typename T>
+	slot_map<T>::slot_map(slot_map&& other) noexcept : m_values{std::move(other.m_values)}, m_value_slots{std::move(other.m_value_slots)}, m_slots{std::move(other.m_slots)},
+													   m_free_head{std::exchange(other.m_free_head, no_slot)}
+	{
+		// the free list lived in the slots that moved away
+		other.m_slots.clear();
+	}
+
+	template <typename T>
+	slot_map<T>& slot_map<T>::operator=(slot_map&& other) noexcept
+	{
+		if (this != &other)
+		{
+			m_values = std::move(other.m_values);
+			m_value_slots = std::move(other.m_value_slots);
+			m_slots = std::move(other.m_slots);
+			m_free_head = std::exchange(other.m_free_head, no_slot);
+			other.m_slots.clear();
+		}
+		return *this;
+	}
+
+	template <typename T>
+	slot_map<T>& slot_map<T>::operator=(const slot_map& other)
+	{
+		if (this != &other)
+		{
+			slot_map copy{other};
+			*this = std::move(copy);
+		}
+		return *this;
+	}
+
+	template <typename T>
+	void slot_map<T>::repoint_slots() noexcept
+	{
+		for (std::size_t position = 0; position < m_value_slots.size(); position++)
+		{
+			m_slots[m_value_slots[position]].value = m_values.data_at(position);
+		}
+	}
+
+	template <typename T>
+	template <typename... Args>
+	slot_map<T>::handle slot_map<T>::emplace(Args&&... args)
+	{
+		bool reuse = m_free_head != no_slot;
+		if (!reuse && m_slots.size() >= no_slot)
+		{
+			throw std::length_error("slot_map: out of handles");
+		}
+		std::uint32_t slot_index = reuse ? m_free_head : static_cast<std::uint32_t>(m_slots.size());
+		std::uint32_t position = static_cast<std::uint32_t>(m_values.size());
+
+		// the element goes in first, so a throwing constructor leaves the free list untouched
+		m_values.emplace_back(std::forward<Args>(args)...);
+		bool slot_recorded = false;
+		try
+		{
+			m_value_slots.push_back(slot_index);
+			slot_recorded = true;
+			if (!reuse)
+			{
+				m_slots.push_back(slot{position, 0, nullptr});
+			}
+		}
+		catch (...)
+		{
+			if (slot_recorded)
+			{
+				m_value_slots.pop_back();
+			}
+			m_values.pop_back();
+			throw;
+		}
+
+		slot& current_slot = m_slots[slot_index];
+		if (reuse)
+		{
+			m_free_head = current_slot.position;
+		}
+		current_slot.position = position;
+		current_slot.generation++;
+		current_slot.value = m_values.data_at(position);
+		return handle{slot_index, current_slot.generation};
+	}
+
+	template <typename T>
+	slot_map<T>::handle slot_map<T>::insert(const T& val)
+	{
+		return emplace(val);
+	}
+
+	template <typename T>
+	slot_map<T>::handle slot_map<T>::insert(T&& val)
+	{
+		return emplace(std::move(val));
+	}
+
+	template <typename T>
+	bool slot_map<T>::erase(handle h)
+	{
+		if (!contains(h))
+		{
+			return false;
+		}
+
+		slot& erased_slot = m_slots[h.index];
+		std::size_t position = erased_slot.position;
+		std::size_t last = m_values.size() - 1;
+		if (position != last)
+		{
+			m_values[position] = std::move(m_values[last]);
+			std::uint32_t moved_slot = m_value_slots[last];
+			m_value_slots[position] = moved_slot;
+			m_slots[moved_slot].position = static_cast<std::uint32_t>(position);
+			m_slots[moved_slot].value = m_values.data_at(position);
+		}
+		m_values.pop_back();
+		m_value_slots.pop_back();
+
+		erased_slot.generation++;
+		if (erased_slot.generation != retired_generation)
+		{
+			erased_slot.position = m_free_head;
+			m_free_head = h.index;
+		}
+		return true;
+	}
+
+	template <typename T>
+	void slot_map<T>::clear()
+	{
+		// every live slot is erased, so outstanding handles go stale
+		for (std::size_t position = 0; position < m_value_slots.size(); position++)
+		{
+			std::uint32_t slot_index = m_value_slots[position];
+			slot& erased_slot = m_slots[slot_index];
+			erased_slot.generation++;
+			if (erased_slot.generation != retired_generation)
+			{
+				erased_slot.position = m_free_head;
+				m_free_head = slot_index;
+			}
+		}
+		m_values.clear();
+		m_value_slots.clear();
+	}
+
+	template <typename T>
+	T* slot_map<T>::find(handle h) noexcept
+	{
+		return const_cast<T*>(std::as_const(*this).find(h));
+	}
+
+	template <typename T>
+	const T* slot_map<T>::find(handle h) const noexcept
+	{
+		if (h.index < m_slots.size())
+		{
+			const slot& current_slot = m_slots[h.index];
+			if (current_slot.generation == h.generation && (h.generation & 1) != 0)
+			{
+				return current_slot.value;
+			}
+		}
+		return nullptr;
+	}
+
+	template <typename T>
+	bool slot_map<T>::contains(handle h) const noexcept
+	{
+		return find(h) != nullptr;
+	}
+
+	template <typename T>
+	T& slot_map<T>::at(handle h)
+	{
+		T* elem = find(h);
+		if (elem == nullptr)
+		{
+			throw std::out_of_range("slot_map::at: stale handle");
+		}
+		return *elem;
+	}
+
+	template <typename T>
+	const T& slot_map<T>::at(handle h) const
+	{
+		const T* elem = find(h);
+		if (elem == nullptr)
+		{
+			throw std::out_of_range("slot_map::at: stale handle");
+		}
+		return *elem;
+	}
+
+	template <typename T>
+	T& slot_map<T>::operator[](handle h) noexcept
+	{
+		return *m_slots[h.index].value;
+	}
+
+	template <typename T>
+	const T& slot_map<T>::operator[](handle h) const noexcept
+	{
+		return *m_slots[h.index].value;
+	}
+
+	template <typename T>
+	slot_map<T>::handle slot_map<T>::handle_at(std::size_t position) const noexcept
+	{
+		std::uint32_t slot_index = m_value_slots[position];
+		return handle{slot_index, m_slots[slot_index].generation};
+	}
+
+	template <typename T>
+	void slot_map<T>::reserve(std::size_t n)
+	{
+		m_values.reserve(n);
+		m_value_slots.reserve(n);
+		m_slots.reserve(n);
+	}
+
+	template <typename T>
+	bool slot_map<T>::empty() const noexcept
+	{
+		return m_values.empty();
+	}
+
+	template <typename T>
+	std::size_t slot_map<T>::size() const noexcept
+	{
+		return m_values.size();
+	}
+
+	template <typename T>
+	slot_map<T>::iterator slot_map<T>::begin() noexcept
+	{
+		return m_values.begin();
+	}
+
+	template <typename T>
+	slot_map<T>::iterator slot_map<T>::end() noexcept
+	{
+		return m_values.end();
+	}
+
+	template <typename T>
+	slot_map<T>::const_iterator slot_map<T>::begin() const noexcept
+	{
+		return m_values.cbegin();
+	}
+
+	template <typename T>
+	slot_map<T>::const_iterator slot_map<T>::end() const noexcept
+	{
+		return m_values.cend();
+	}
+
+	template <typename T>
+	slot_map<T>::const_iterator slot_map<T>::cbegin() const noexcept
+	{
+		return m_values.cbegin();
+	}
+
+	template <typename T>
+	slot_map<T>::const_iterator slot_map<T>::cend() const noexcept
+	{
+		return m_values.cend();
 	}
 
-	template <typename T, typename Allocator, typename ChunkAllocator>
-	constexpr void swap(typename stable_vector<T, Allocator, ChunkAllocator>::const_reverse_iterator& a, typename stable_vector<T, Allocator, ChunkAllocator>::const_reverse_iterator& b) noexcept
+	template <typename T>
+	auto slot_map<T>::segments() noexcept
+	{
+		return m_values.segments();
+	}
+
+	template <typename T>
+	auto slot_map<T>::segments() const noexcept
+	{
+		return m_values.segments();
+	}
+
+
+
+
+
+
+	namespace detail
+	{
+		struct segment_probe
+		{
+			template <typename Pointer>
+			constexpr bool operator()(Pointer, Pointer) const noexcept  { return true; }
+		};
+
+		// iterators whose ranges can be split into contiguous pieces through a for_each_segment hidden friend
+		template <typename It>
+		concept segmented_iterator = requires(It first, It last, segment_probe fn)
+		{
+			{ for_each_segment(first, last, fn) } -> std::same_as<bool>;
+		};
+	}
+
+	// the algorithms below behave like their std:: counterparts, but run the std:: version once per
+	// contiguous chunk when handed stable_vector iterators, so memmove and vectorized loops apply
+
+	template <typename InputIt, typename Fn>
+	constexpr Fn for_each(InputIt first, InputIt last, Fn fn)
+	{
+		if constexpr (detail::segmented_iterator<InputIt>)
+		{
+			for_each_segment(first, last, [&fn](auto segment_first, auto segment_last)
+			{
+				std::for_each(segment_first, segment_last, std::ref(fn));
+				return true;
+			});
+			return fn;
+		}
+		else
+		{
+			return std::for_each(first, last, std::move(fn));
+		}
+	}
+
+	template <typename InputIt, typename OutputIt, typename UnaryOp>
+	constexpr OutputIt transform(InputIt first, InputIt last, OutputIt d_first, UnaryOp op)
+	{
+		if constexpr (detail::segmented_iterator<OutputIt> && std::random_access_iterator<InputIt>)
+		{
+			// split on the destination, the nested call splits the source again if it is segmented too
+			OutputIt d_last = d_first + (last - first);
+			for_each_segment(d_first, d_last, [&first, &op](auto segment_first, auto segment_last)
+			{
+				InputIt next = first + (segment_last - segment_first);
+				my_adt::transform(first, next, segment_first, std::ref(op));
+				first = next;
+				return true;
+			});
+			return d_last;
+		}
+		else if constexpr (detail::segmented_iterator<InputIt>)
+		{
+			for_each_segment(first, last, [&d_first, &op](auto segment_first, auto segment_last)
+			{
+				d_first = std::transform(segment_first, segment_last, d_first, std::ref(op));
+				return true;
+			});
+			return d_first;
+		}
+		else
+		{
+			return std::transform(first, last, d_first, std::move(op));
+		}
+	}
+
+	template <typename InputIt, typename OutputIt>
+	constexpr OutputIt copy(InputIt first, InputIt last, OutputIt d_first)
+	{
+		if constexpr (detail::segmented_iterator<OutputIt> && std::random_access_iterator<InputIt>)
+		{
+			// split on the destination, the nested call splits the source again if it is segmented too
+			OutputIt d_last = d_first + (last - first);
+			for_each_segment(d_first, d_last, [&first](auto segment_first, auto segment_last)
+			{
+				InputIt next = first + (segment_last - segment_first);
+				my_adt::copy(first, next, segment_first);
+				first = next;
+				return true;
+			});
+			return d_last;
+		}
+		else if constexpr (detail::segmented_iterator<InputIt>)
+		{
+			for_each_segment(first, last, [&d_first](auto segment_first, auto segment_last)
+			{
+				d_first = std::copy(segment_first, segment_last, d_first);
+				return true;
+			});
+			return d_first;
+		}
+		else
+		{
+			return std::copy(first, last, d_first);
+		}
+	}
+
+	template <typename ForwardIt, typename T>
+	constexpr void fill(ForwardIt first, ForwardIt last, const T& value)
+	{
+		if constexpr (detail::segmented_iterator<ForwardIt>)
+		{
+			for_each_segment(first, last, [&value](auto segment_first, auto segment_last)
+			{
+				std::fill(segment_first, segment_last, value);
+				return true;
+			});
+		}
+		else
+		{
+			std::fill(first, last, value);
+		}
+	}
+
+	template <typename InputIt, typename T>
+	constexpr InputIt find(InputIt first, InputIt last, const T& value)
+	{
+		if constexpr (detail::segmented_iterator<InputIt>)
+		{
+			// ends up as last - first when nothing matches
+			std::iter_difference_t<InputIt> offset = 0;
+			for_each_segment(first, last, [&offset, &value](auto segment_first, auto segment_last)
+			{
+				auto found = std::find(segment_first, segment_last, value);
+				offset += found - segment_first;
+				return found == segment_last;
+			});
+			return first + offset;
+		}
+		else
+		{
+			return std::find(first, last, value);
+		}
+	}
+
+	template <typename InputIt, typename UnaryPred>
+	constexpr std::iter_difference_t<InputIt> count_if(InputIt first, InputIt last, UnaryPred pred)
+	{
+		if constexpr (detail::segmented_iterator<InputIt>)
+		{
+			std::iter_difference_t<InputIt> count = 0;
+			for_each_segment(first, last, [&count, &pred](auto segment_first, auto segment_last)
+			{
+				count += std::count_if(segment_first, segment_last, std::ref(pred));
+				return true;
+			});
+			return count;
+		}
+		else
+		{
+			return std::count_if(first, last, std::move(pred));
+		}
+	}
+
+	template <typename InputIt, typename T, typename BinaryOp = std::plus<>>
+	constexpr T accumulate(InputIt first, InputIt last, T init, BinaryOp op = BinaryOp{})
+	{
+		if constexpr (detail::segmented_iterator<InputIt>)
+		{
+			for_each_segment(first, last, [&init, &op](auto segment_first, auto segment_last)
+			{
+				init = std::accumulate(segment_first, segment_last, std::move(init), std::ref(op));
+				return true;
+			});
+			return init;
+		}
+		else
+		{
+			return std::accumulate(first, last, std::move(init), std::move(op));
+		}
+	}
+
+	template <typename InputIt1, typename InputIt2>
+	constexpr bool equal(InputIt1 first1, InputIt1 last1, InputIt2 first2)
+	{
+		if constexpr (detail::segmented_iterator<InputIt2> && std::random_access_iterator<InputIt1>)
+		{
+			// split on the second range, the nested call splits the first again if it is segmented too
+			return for_each_segment(first2, first2 + (last1 - first1), [&first1](auto segment_first, auto segment_last)
+			{
+				InputIt1 next = first1 + (segment_last - segment_first);
+				bool segment_equal = my_adt::equal(first1, next, segment_first);
+				first1 = next;
+				return segment_equal;
+			});
+		}
+		else if constexpr (detail::segmented_iterator<InputIt1>)
+		{
+			return for_each_segment(first1, last1, [&first2](auto segment_first, auto segment_last)
+			{
+				bool segment_equal = std::equal(segment_first, segment_last, first2);
+				std::advance(first2, segment_last - segment_first);
+				return segment_equal;
+			});
+		}
+		else
+		{
+			return std::equal(first1, last1, first2);
+		}
+	}
+
+
+
+
+
+
+	// policies in the spirit of std::execution; the std:: ones would pull in the parallel backend
+	// (and its link dependency) for every user of this header
+	namespace execution
+	{
+		struct sequenced_policy {};
+		struct parallel_policy {};
+		struct parallel_unsequenced_policy {};
+
+		inline constexpr sequenced_policy seq{};
+		inline constexpr parallel_policy par{};
+		inline constexpr parallel_unsequenced_policy par_unseq{};
+
+		template <typename T>
+		struct is_execution_policy : std::false_type {};
+		template <>
+		struct is_execution_policy<sequenced_policy> : std::true_type {};
+		template <>
+		struct is_execution_policy<parallel_policy> : std::true_type {};
+		template <>
+		struct is_execution_policy<parallel_unsequenced_policy> : std::true_type {};
+
+		template <typename T>
+		inline constexpr bool is_execution_policy_v = is_execution_policy<T>::value;
+	}
+
+	namespace detail
+	{
+		template <typename ExecutionPolicy>
+		concept parallel_policy = std::is_same_v<std::remove_cvref_t<ExecutionPolicy>, execution::parallel_policy>
+			|| std::is_same_v<std::remove_cvref_t<ExecutionPolicy>, execution::parallel_unsequenced_policy>;
+
+		// a fixed set of workers that, together with the calling thread, drain the tasks of one job at a time
+		class thread_pool
+		{
+			public:
+				explicit thread_pool(std::size_t worker_count);
+				~thread_pool();
+
+				thread_pool(const thread_pool&) = delete;
+				thread_pool& operator=(const thread_pool&) = delete;
+
+				static thread_pool& shared();
+
+				// workers plus the calling thread
+				std::size_t concurrency() const noexcept;
+
+				// calls fn(task) for every task in [0, task_count) and returns once all of them are done;
+				// like the std:: parallel algorithms, an exception escaping fn calls std::terminate
+				template <typename Fn>
+				void run(std::size_t task_count, Fn& fn);
+
+			private:
+				std::mutex m_run_mutex;
+				std::mutex m_mutex;
+				std::condition_variable m_job_ready;
+				std::condition_variable m_job_done;
+
+				void (*m_invoke)(void* job, std::size_t task);
+				void* m_job;
+				std::size_t m_task_count;
+				std::atomic<std::size_t> m_next_task;
+				std::size_t m_busy_workers;
+				std::size_t m_generation;
+				bool m_stopping;
+
+				std::vector<std::thread> m_workers;
+
+				static inline thread_local bool t_is_worker = false;
+				// set while the calling thread drains its own job, so tasks it runs take the inline path as a worker's do
+				static inline thread_local bool t_in_run = false;
+
+				struct in_run_scope
+				{
+					in_run_scope() noexcept  { t_in_run = true; }
+					~in_run_scope()  { t_in_run = false; }
+
+					in_run_scope(const in_run_scope&) = delete;
+					in_run_scope& operator=(const in_run_scope&) = delete;
+				};
+
+				void worker_loop();
+				void drain() noexcept;
+		};
+
+		inline thread_pool::thread_pool(std::size_t worker_count) : m_invoke{nullptr}, m_job{nullptr}, m_task_count{0}, m_next_task{0}, m_busy_workers{0}, m_generation{0}, m_stopping{false}
+		{
+			m_workers.reserve(worker_count);
+			for (std::size_t i = 0; i < worker_count; i++)
+			{
+				m_workers.emplace_back([this] { worker_loop(); });
+			}
+		}
+
+		inline thread_pool::~thread_pool()
+		{
+			{
+				std::scoped_lock lock{m_mutex};
+				m_stopping = true;
+			}
+			m_job_ready.notify_all();
+
+			for (std::thread& worker : m_workers)
+			{
+				worker.join();
+			}
+		}
+
+		inline thread_pool& thread_pool::shared()
+		{
+			static thread_pool pool{std::max(std::thread::hardware_concurrency(), 1u) - 1};
+			return pool;
+		}
+
+		inline std::size_t thread_pool::concurrency() const noexcept
+		{
+			return m_workers.size() + 1;
+		}
+
+		template <typename Fn>
+		void thread_pool::run(std::size_t task_count, Fn& fn)
+		{
+			// nested parallel calls from inside a task run inline rather than waiting on themselves
+			if (m_workers.empty() || task_count <= 1 || t_is_worker || t_in_run)
+			{
+				for (std::size_t task = 0; task < task_count; task++)
+				{
+					fn(task);
+				}
+				return;
+			}
+
+			std::scoped_lock run_lock{m_run_mutex};
+			{
+				std::scoped_lock lock{m_mutex};
+				m_invoke = [](void* job, std::size_t task) { (*static_cast<Fn*>(job))(task); };
+				m_job = &fn;
+				m_task_count = task_count;
+				m_next_task.store(0, std::memory_order_relaxed);
+				m_busy_workers = m_workers.size();
+				m_generation++;
+			}
+			m_job_ready.notify_all();
+
+			{
+				in_run_scope in_run;
+				drain();
+			}
+
+			std::unique_lock lock{m_mutex};
+			m_job_done.wait(lock, [this] { return m_busy_workers == 0; });
+		}
+
+		inline void thread_pool::worker_loop()
+		{
+			t_is_worker = true;
+
+			std::size_t seen_generation = 0;
+			std::unique_lock lock{m_mutex};
+			while (true)
+			{
+				m_job_ready.wait(lock, [&] { return m_stopping || m_generation != seen_generation; });
+				if (m_stopping)
+				{
+					return;
+				}
+				seen_generation = m_generation;
+
+				lock.unlock();
+				drain();
+				lock.lock();
+
+				if (--m_busy_workers == 0)
+				{
+					m_job_done.notify_one();
+				}
+			}
+		}
+
+		inline void thread_pool::drain() noexcept
+		{
+			for (std::size_t task = m_next_task.fetch_add(1, std::memory_order_relaxed); task < m_task_count; task = m_next_task.fetch_add(1, std::memory_order_relaxed))
+			{
+				m_invoke(m_job, task);
+			}
+		}
+
+
+		// ranges shorter than this per partition are not worth handing to another thread
+		inline constexpr std::size_t parallel_grain = 4096;
+		// several partitions per thread so that uneven element costs still even out
+		inline constexpr std::size_t partitions_per_thread = 4;
+
+		inline std::size_t partition_count(std::size_t n)
+		{
+			if (n == 0)
+			{
+				return 0;
+			}
+			return std::clamp<std::size_t>(n / parallel_grain, 1, thread_pool::shared().concurrency() * partitions_per_thread);
+		}
+
+		// splits [0, n) into partitions of equal length regardless of chunk boundaries, and calls fn(partition, begin, end) for each on the shared pool
+		template <typename Fn>
+		void run_partitions(std::size_t n, std::size_t partitions, Fn fn)
+		{
+			auto task = [&](std::size_t partition)
+			{
+				fn(partition, n * partition / partitions, n * (partition + 1) / partitions);
+			};
+			thread_pool::shared().run(partitions, task);
+		}
+	}
+
+	// execution policy overloads; with stable_vector iterators and a parallel policy the range is cut into
+	// evenly sized pieces, since the last chunk alone holds about half of the elements. Other iterators run sequentially
+
+	template <typename ExecutionPolicy, typename ForwardIt, typename Fn>
+		requires execution::is_execution_policy_v<std::remove_cvref_t<ExecutionPolicy>>
+	void for_each(ExecutionPolicy&&, ForwardIt first, ForwardIt last, Fn fn)
+	{
+		if constexpr (detail::segmented_iterator<ForwardIt> && detail::parallel_policy<ExecutionPolicy>)
+		{
+			std::size_t n = static_cast<std::size_t>(last - first);
+			detail::run_partitions(n, detail::partition_count(n), [&](std::size_t, std::size_t begin, std::size_t end)
+			{
+				my_adt::for_each(first + begin, first + end, std::ref(fn));
+			});
+		}
+		else if constexpr (detail::segmented_iterator<ForwardIt>)
+		{
+			my_adt::for_each(first, last, std::move(fn));
+		}
+		else
+		{
+			std::for_each(first, last, std::move(fn));
+		}
+	}
+
+	template <typename ExecutionPolicy, typename ForwardIt1, typename ForwardIt2, typename UnaryOp>
+		requires execution::is_execution_policy_v<std::remove_cvref_t<ExecutionPolicy>>
+	ForwardIt2 transform(ExecutionPolicy&&, ForwardIt1 first, ForwardIt1 last, ForwardIt2 d_first, UnaryOp op)
+	{
+		constexpr bool segmented = detail::segmented_iterator<ForwardIt1> || detail::segmented_iterator<ForwardIt2>;
+
+		if constexpr (segmented && detail::parallel_policy<ExecutionPolicy> && std::random_access_iterator<ForwardIt1> && std::random_access_iterator<ForwardIt2>)
+		{
+			std::size_t n = static_cast<std::size_t>(last - first);
+			detail::run_partitions(n, detail::partition_count(n), [&](std::size_t, std::size_t begin, std::size_t end)
+			{
+				my_adt::transform(first + begin, first + end, d_first + begin, std::ref(op));
+			});
+			return d_first + n;
+		}
+		else if constexpr (segmented)
+		{
+			return my_adt::transform(first, last, d_first, std::move(op));
+		}
+		else
+		{
+			return std::transform(first, last, d_first, std::move(op));
+		}
+	}
+
+	template <typename ExecutionPolicy, typename ForwardIt, typename T, typename BinaryOp = std::plus<>>
+		requires execution::is_execution_policy_v<std::remove_cvref_t<ExecutionPolicy>>
+	T reduce(ExecutionPolicy&&, ForwardIt first, ForwardIt last, T init, BinaryOp op = BinaryOp{})
+	{
+		if constexpr (detail::segmented_iterator<ForwardIt> && detail::parallel_policy<ExecutionPolicy>)
+		{
+			std::size_t n = static_cast<std::size_t>(last - first);
+			std::size_t partitions = detail::partition_count(n);
+			std::vector<std::optional<T>> partials(partitions);
+
+			// every partition is non-empty, so each seeds its partial result with its own first element
+			detail::run_partitions(n, partitions, [&](std::size_t partition, std::size_t begin, std::size_t end)
+			{
+				T partial = *(first + begin);
+				for_each_segment(first + (begin + 1), first + end, [&](auto segment_first, auto segment_last)
+				{
+					partial = std::reduce(segment_first, segment_last, std::move(partial), std::ref(op));
+					return true;
+				});
+				partials[partition].emplace(std::move(partial));
+			});
+
+			for (std::optional<T>& partial : partials)
+			{
+				init = op(std::move(init), std::move(*partial));
+			}
+			return init;
+		}
+		else if constexpr (detail::segmented_iterator<ForwardIt>)
+		{
+			return my_adt::accumulate(first, last, std::move(init), std::move(op));
+		}
+		else
+		{
+			return std::reduce(first, last, std::move(init), std::move(op));
+		}
+	}
+
+	template <typename ExecutionPolicy, typename ForwardIt, typename T, typename BinaryReduceOp, typename UnaryTransformOp>
+		requires execution::is_execution_policy_v<std::remove_cvref_t<ExecutionPolicy>>
+	T transform_reduce(ExecutionPolicy&&, ForwardIt first, ForwardIt last, T init, BinaryReduceOp reduce_op, UnaryTransformOp transform_op)
 	{
-		swap(static_cast<stable_vector<T, Allocator, ChunkAllocator>::raw_iterator&>(a), static_cast<stable_vector<T, Allocator, ChunkAllocator>::raw_iterator&>(b));
+		if constexpr (detail::segmented_iterator<ForwardIt> && detail::parallel_policy<ExecutionPolicy>)
+		{
+			std::size_t n = static_cast<std::size_t>(last - first);
+			std::size_t partitions = detail::partition_count(n);
+			std::vector<std::optional<T>> partials(partitions);
+
+			detail::run_partitions(n, partitions, [&](std::size_t partition, std::size_t begin, std::size_t end)
+			{
+				T partial = transform_op(*(first + begin));
+				for_each_segment(first + (begin + 1), first + end, [&](auto segment_first, auto segment_last)
+				{
+					partial = std::transform_reduce(segment_first, segment_last, std::move(partial), std::ref(reduce_op), std::ref(transform_op));
+					return true;
+				});
+				partials[partition].emplace(std::move(partial));
+			});
+
+			for (std::optional<T>& partial : partials)
+			{
+				init = reduce_op(std::move(init), std::move(*partial));
+			}
+			return init;
+		}
+		else if constexpr (detail::segmented_iterator<ForwardIt>)
+		{
+			for_each_segment(first, last, [&](auto segment_first, auto segment_last)
+			{
+				init = std::transform_reduce(segment_first, segment_last, std::move(init), std::ref(reduce_op), std::ref(transform_op));
+				return true;
+			});
+			return init;
+		}
+		else
+		{
+			return std::transform_reduce(first, last, std::move(init), std::move(reduce_op), std::move(transform_op));
+		}
 	}
 }
\ No newline at end of file